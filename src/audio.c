@@ -9,6 +9,7 @@
 #include "wav_recorder.h"
 #include "ymglue.h"
 #include "midi.h"
+#include "scheduler.h"
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -226,6 +227,13 @@ audio_close(void)
 	}
 }
 
+// VERA samples up to the head position that haven't been rendered yet
+static uint32_t
+vera_samples_pending()
+{
+	return ((vera_samp_pos_hd >> SAMP_POS_FRAC_BITS) - vera_samp_pos_wr) & SAMP_POS_MASK;
+}
+
 void
 audio_step(int cpu_clocks)
 {
@@ -244,6 +252,33 @@ audio_step(int cpu_clocks)
 		cpu_clocks -= max_cpu_clks;
 		if (cpu_clocks > 0) audio_render();
 	}
+
+	// the AFLOW IRQ can't wait for the next batch to be rendered
+	uint32_t samples = pcm_samples_until_almost_empty();
+	if (samples != 0 && samples <= vera_samples_pending()) {
+		audio_render();
+	}
+}
+
+// Clocks until the PCM FIFO will be almost empty, so that the scheduler
+// steps the audio then, and a program that waits for the AFLOW IRQ gets it
+// in time.
+uint32_t
+audio_next_event()
+{
+	if (audio_dev == 0) {
+		return SCHEDULER_NO_EVENT;
+	}
+	uint32_t samples = pcm_samples_until_almost_empty();
+	if (samples == 0 || samples == UINT32_MAX) {
+		return SCHEDULER_NO_EVENT;
+	}
+
+	// audio_step() renders once the FIFO would be below the mark
+	samples -= SDL_min(samples, vera_samples_pending());
+	samples = SDL_min(samples, SAMPLES_PER_BUFFER / 2);
+	uint32_t frac = vera_samp_pos_hd & ((1 << SAMP_POS_FRAC_BITS) - 1);
+	return ((samples << SAMP_POS_FRAC_BITS) - frac) / VERA_SAMP_CLKS_PER_CPU_CLK + 1;
 }
 
 void
@@ -252,7 +287,8 @@ audio_render()
 	// Render all audio sources until read and write positions catch up
 	// This happens when there's a change to sound registers or one of the
 	// sources' sample buffer head position is too far
-	if (audio_dev == 0) {
+	// Headless machines on other threads don't have the audio output.
+	if (audio_dev == 0 || headless) {
 		return;
 	}
 
@@ -411,6 +447,7 @@ audio_render()
 		buffer_written -= buffer_skip_amount;
 	}
 	SDL_UnlockAudioDevice(audio_dev);
+	wav_recorder_flush();
 
 	// catch up all buffers if they are too far behind
 	uint32_t skip = len_vera - len;
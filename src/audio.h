@@ -11,6 +11,7 @@
 void audio_init(const char *dev_name, int num_audio_buffers);
 void audio_close(void);
 void audio_step(int cpu_clocks);
+uint32_t audio_next_event();
 void audio_render();
 
 void audio_usage(void);
@@ -22,9 +22,9 @@
 //
 // *******************************************************************************************
 
-static void ainx() { 		// absolute indexed branch
+static void FN(ainx)() { 		// absolute indexed branch
     uint16_t eahelp, eahelp2;
-    eahelp = (uint16_t)read6502(regs.pc, regs.k) | (uint16_t)((uint16_t)read6502(regs.pc+1, regs.k) << 8);
+    eahelp = (uint16_t)fetch6502(regs.pc) | (uint16_t)((uint16_t)fetch6502(regs.pc+1) << 8);
     eahelp = (eahelp + regs.x) & 0xFFFF;
 #if 0
     eahelp2 = (eahelp & 0xFF00) | ((eahelp + 1) & 0x00FF); //replicate 6502 page-boundary wraparound bug
@@ -41,7 +41,7 @@ static void ainx() { 		// absolute indexed branch
 //
 // *******************************************************************************************
 
-static void stz() {
+static void FN(stz)() {
     putvalue(0, memory_16bit());
 }
 
@@ -51,10 +51,10 @@ static void stz() {
 //
 // *******************************************************************************************
 
-static void bra() {
+static void FN(bra)() {
     oldpc = regs.pc;
     regs.pc += reladdr;
-    if (regs.e && (oldpc & 0xFF00) != (regs.pc & 0xFF00)) clockticks6502++; //check if jump crossed a page boundary
+    if (emulation() && (oldpc & 0xFF00) != (regs.pc & 0xFF00)) clockticks6502++; //check if jump crossed a page boundary
 }
 
 // *******************************************************************************************
@@ -63,9 +63,7 @@ static void bra() {
 //
 // *******************************************************************************************
 
-static void phx() {
-    penaltym = 1;
-
+static void FN(phx)() {
     if (index_16bit()) {
         push16(regs.x);
     } else {
@@ -73,9 +71,7 @@ static void phx() {
     }
 }
 
-static void plx() {
-    penaltym = 1;
-
+static void FN(plx)() {
     if (index_16bit()) {
         regs.x = pull16();
         zerocalc(regs.x, 1);
@@ -88,9 +84,7 @@ static void plx() {
     }
 }
 
-static void phy() {
-    penaltym = 1;
-
+static void FN(phy)() {
     if (index_16bit()) {
         push16(regs.y);
     } else {
@@ -98,9 +92,7 @@ static void phy() {
     }
 }
 
-static void ply() {
-    penaltym = 1;
-
+static void FN(ply)() {
     if (index_16bit()) {
         regs.y = pull16();
         zerocalc(regs.y, 1);
@@ -119,7 +111,7 @@ static void ply() {
 //
 // *******************************************************************************************
 
-static void tsb() {
+static void FN(tsb)() {
     value = getvalue(memory_16bit()); 							// Read memory
     result = acc_for_mode() & value;                // calculate A & memory
     zerocalc(result, memory_16bit()); 								// Set Z flag from this.
@@ -127,7 +119,7 @@ static void tsb() {
     putvalue(result, memory_16bit());
 }
 
-static void trb() {
+static void FN(trb)() {
     value = getvalue(memory_16bit()); 							// Read memory
     result = acc_for_mode() & value;  			// calculate A & memory
     zerocalc(result, memory_16bit()); 								// Set Z flag from this.
@@ -141,7 +133,7 @@ static void trb() {
 //
 // *******************************************************************************************
 
-static void dbg() {
+static void FN(dbg)() {
     stop6502(regs.pc - 1, regs.k);
 }
 
@@ -151,7 +143,7 @@ static void dbg() {
 //
 // *******************************************************************************************
 
-static void wai() {
+static void FN(wai)() {
 	waiting = 1;
 }
 
@@ -160,7 +152,7 @@ static void wai() {
 //                                     BBR and BBS
 //
 // *******************************************************************************************
-static void bbr(uint16_t bitmask)
+static void FN(bbr)(uint16_t bitmask)
 {
     if (warn_rockwell) rockwell_warning("BBR");
 	if ((getvalue(0) & bitmask) == 0) {
@@ -171,16 +163,16 @@ static void bbr(uint16_t bitmask)
 	}
 }
 
-static void bbr0() { bbr(0x01); }
-static void bbr1() { bbr(0x02); }
-static void bbr2() { bbr(0x04); }
-static void bbr3() { bbr(0x08); }
-static void bbr4() { bbr(0x10); }
-static void bbr5() { bbr(0x20); }
-static void bbr6() { bbr(0x40); }
-static void bbr7() { bbr(0x80); }
+static void FN(bbr0)() { FN(bbr)(0x01); }
+static void FN(bbr1)() { FN(bbr)(0x02); }
+static void FN(bbr2)() { FN(bbr)(0x04); }
+static void FN(bbr3)() { FN(bbr)(0x08); }
+static void FN(bbr4)() { FN(bbr)(0x10); }
+static void FN(bbr5)() { FN(bbr)(0x20); }
+static void FN(bbr6)() { FN(bbr)(0x40); }
+static void FN(bbr7)() { FN(bbr)(0x80); }
 
-static void bbs(uint16_t bitmask)
+static void FN(bbs)(uint16_t bitmask)
 {
     if (warn_rockwell) rockwell_warning("BBS");
 	if ((getvalue(0) & bitmask) != 0) {
@@ -191,14 +183,14 @@ static void bbs(uint16_t bitmask)
 	}
 }
 
-static void bbs0() { bbs(0x01); }
-static void bbs1() { bbs(0x02); }
-static void bbs2() { bbs(0x04); }
-static void bbs3() { bbs(0x08); }
-static void bbs4() { bbs(0x10); }
-static void bbs5() { bbs(0x20); }
-static void bbs6() { bbs(0x40); }
-static void bbs7() { bbs(0x80); }
+static void FN(bbs0)() { FN(bbs)(0x01); }
+static void FN(bbs1)() { FN(bbs)(0x02); }
+static void FN(bbs2)() { FN(bbs)(0x04); }
+static void FN(bbs3)() { FN(bbs)(0x08); }
+static void FN(bbs4)() { FN(bbs)(0x10); }
+static void FN(bbs5)() { FN(bbs)(0x20); }
+static void FN(bbs6)() { FN(bbs)(0x40); }
+static void FN(bbs7)() { FN(bbs)(0x80); }
 
 // *******************************************************************************************
 //
@@ -206,20 +198,20 @@ static void bbs7() { bbs(0x80); }
 //
 // *******************************************************************************************
 
-static void smb0() { if (warn_rockwell) rockwell_warning("SMB0"); putvalue(getvalue(0) | 0x01, 0); }
-static void smb1() { if (warn_rockwell) rockwell_warning("SMB1"); putvalue(getvalue(0) | 0x02, 0); }
-static void smb2() { if (warn_rockwell) rockwell_warning("SMB2"); putvalue(getvalue(0) | 0x04, 0); }
-static void smb3() { if (warn_rockwell) rockwell_warning("SMB3"); putvalue(getvalue(0) | 0x08, 0); }
-static void smb4() { if (warn_rockwell) rockwell_warning("SMB4"); putvalue(getvalue(0) | 0x10, 0); }
-static void smb5() { if (warn_rockwell) rockwell_warning("SMB5"); putvalue(getvalue(0) | 0x20, 0); }
-static void smb6() { if (warn_rockwell) rockwell_warning("SMB6"); putvalue(getvalue(0) | 0x40, 0); }
-static void smb7() { if (warn_rockwell) rockwell_warning("SMB7"); putvalue(getvalue(0) | 0x80, 0); }
-
-static void rmb0() { if (warn_rockwell) rockwell_warning("RMB0"); putvalue(getvalue(0) & ~0x01, 0); }
-static void rmb1() { if (warn_rockwell) rockwell_warning("RMB1"); putvalue(getvalue(0) & ~0x02, 0); }
-static void rmb2() { if (warn_rockwell) rockwell_warning("RMB2"); putvalue(getvalue(0) & ~0x04, 0); }
-static void rmb3() { if (warn_rockwell) rockwell_warning("RMB3"); putvalue(getvalue(0) & ~0x08, 0); }
-static void rmb4() { if (warn_rockwell) rockwell_warning("RMB4"); putvalue(getvalue(0) & ~0x10, 0); }
-static void rmb5() { if (warn_rockwell) rockwell_warning("RMB5"); putvalue(getvalue(0) & ~0x20, 0); }
-static void rmb6() { if (warn_rockwell) rockwell_warning("RMB6"); putvalue(getvalue(0) & ~0x40, 0); }
-static void rmb7() { if (warn_rockwell) rockwell_warning("RMB7"); putvalue(getvalue(0) & ~0x80, 0); }
+static void FN(smb0)() { if (warn_rockwell) rockwell_warning("SMB0"); putvalue(getvalue(0) | 0x01, 0); }
+static void FN(smb1)() { if (warn_rockwell) rockwell_warning("SMB1"); putvalue(getvalue(0) | 0x02, 0); }
+static void FN(smb2)() { if (warn_rockwell) rockwell_warning("SMB2"); putvalue(getvalue(0) | 0x04, 0); }
+static void FN(smb3)() { if (warn_rockwell) rockwell_warning("SMB3"); putvalue(getvalue(0) | 0x08, 0); }
+static void FN(smb4)() { if (warn_rockwell) rockwell_warning("SMB4"); putvalue(getvalue(0) | 0x10, 0); }
+static void FN(smb5)() { if (warn_rockwell) rockwell_warning("SMB5"); putvalue(getvalue(0) | 0x20, 0); }
+static void FN(smb6)() { if (warn_rockwell) rockwell_warning("SMB6"); putvalue(getvalue(0) | 0x40, 0); }
+static void FN(smb7)() { if (warn_rockwell) rockwell_warning("SMB7"); putvalue(getvalue(0) | 0x80, 0); }
+
+static void FN(rmb0)() { if (warn_rockwell) rockwell_warning("RMB0"); putvalue(getvalue(0) & ~0x01, 0); }
+static void FN(rmb1)() { if (warn_rockwell) rockwell_warning("RMB1"); putvalue(getvalue(0) & ~0x02, 0); }
+static void FN(rmb2)() { if (warn_rockwell) rockwell_warning("RMB2"); putvalue(getvalue(0) & ~0x04, 0); }
+static void FN(rmb3)() { if (warn_rockwell) rockwell_warning("RMB3"); putvalue(getvalue(0) & ~0x08, 0); }
+static void FN(rmb4)() { if (warn_rockwell) rockwell_warning("RMB4"); putvalue(getvalue(0) & ~0x10, 0); }
+static void FN(rmb5)() { if (warn_rockwell) rockwell_warning("RMB5"); putvalue(getvalue(0) & ~0x20, 0); }
+static void FN(rmb6)() { if (warn_rockwell) rockwell_warning("RMB6"); putvalue(getvalue(0) & ~0x40, 0); }
+static void FN(rmb7)() { if (warn_rockwell) rockwell_warning("RMB7"); putvalue(getvalue(0) & ~0x80, 0); }
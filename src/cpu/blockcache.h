@@ -0,0 +1,124 @@
+// *******************************************************************************************
+//
+//      Instruction block cache. stepblock6502() executes a straight-line run of instructions
+//      (a block) per call. The instruction bytes of a block are copied out of memory once,
+//      together with their lengths, and executed from the copy: opcode and operand fetches
+//      skip read6502() and the bank decoding behind it. Instructions are still dispatched
+//      by the interpreter, and data accesses still go through read6502() and write6502().
+//
+//      A block never crosses a 256 byte page and ends after a control transfer or an
+//      instruction that changes the register widths. It is keyed by the host address of
+//      its first byte and stamped with the write counter of its page, so writes to the page
+//      (including self-modifying code within the block) and bank switches stop it early and
+//      invalidate it. Blocks in $FE00-$FFFF are a single instruction, the emulator snoops on
+//      KERNAL API calls there.
+//
+// *******************************************************************************************
+
+#define BLOCK_CACHE_ENTRIES 2048 // power of two
+#define BLOCK_MAX_INSTRUCTIONS 32
+#define OPLENGTH_ENDS_BLOCK 0x80 // set in the oplength tables by buildtables.py
+
+struct block {
+    const uint8_t *code;  // host address of the first instruction, NULL if unused
+    uint32_t stamp;       // page write counter when decoded
+    uint32_t epoch;       // code_epoch when decoded
+    void (*interpret)();  // interpreter (CPU type and register widths) the lengths are valid for
+    uint8_t count;
+    uint8_t length[BLOCK_MAX_INSTRUCTIONS];
+    uint8_t bytes[BLOCK_MAX_INSTRUCTIONS][4];
+};
+
+// only allocated once a machine runs with -blockcache
+static machine_local struct block *blocks;
+
+static struct block *lookupblock(const uint8_t *code, uint32_t stamp) {
+    uintptr_t key = (uintptr_t)code;
+    struct block *b = &blocks[(key ^ (key >> 11)) & (BLOCK_CACHE_ENTRIES - 1)];
+
+    if (b->code == code && b->stamp == stamp && b->epoch == code_epoch && b->interpret == interpret) {
+        return b;
+    }
+
+    uint16_t room = 0x100 - (regs.pc & 0xff); // bytes left in the page
+    uint8_t max = regs.pc >= 0xfe00 ? 1 : BLOCK_MAX_INSTRUCTIONS;
+
+    b->code = code;
+    b->stamp = stamp;
+    b->epoch = code_epoch;
+    b->interpret = interpret;
+    b->count = 0;
+    while (b->count < max) {
+        uint8_t length = oplength[*code];
+        uint8_t size = length & ~OPLENGTH_ENDS_BLOCK;
+
+        if (size > room) {
+            break;
+        }
+        memcpy(b->bytes[b->count], code, size);
+        b->length[b->count++] = size;
+        code += size;
+        room -= size;
+        if (length & OPLENGTH_ENDS_BLOCK) {
+            break;
+        }
+    }
+    return b;
+}
+
+// Execute one block, returns the number of instructions executed.
+uint32_t stepblock6502() {
+    const uint32_t *version;
+    const uint8_t *bankreg;
+    const uint8_t *code = NULL;
+
+    if (!waiting) {
+        code = memory_code_pointer(regs.pc, regs.k, &version, &bankreg);
+    }
+    if (!blocks) {
+        blocks = calloc(BLOCK_CACHE_ENTRIES, sizeof(struct block));
+    }
+    if (!code || !blocks) {
+        uint32_t count = !waiting;
+        step6502();
+        return count;
+    }
+
+    struct block *b = lookupblock(code, *version);
+    if (!b->count) {
+        // the first instruction crosses the page
+        step6502();
+        return 1;
+    }
+
+    uint8_t bank = *bankreg;
+    uint16_t next = regs.pc;
+    uint8_t i = 0;
+    while (i < b->count) {
+        next += b->length[i];
+
+        opcode_addr = regs.pc;
+        fetchptr = b->bytes[i];
+        opcode = fetchptr[0];
+        regs.pc++;
+        (*interpret)();
+        fetchptr = NULL;
+
+        instructions++;
+        i++;
+
+        if (callexternal) (*loopexternal)();
+
+        if (regs.pc != next || *version != b->stamp || *bankreg != bank) {
+            break;
+        }
+    }
+
+    clockgoal6502 = clockticks6502;
+    return i;
+}
+
+void freeblocks6502() {
+    free(blocks);
+    blocks = NULL;
+}
@@ -4,6 +4,8 @@
 #		File:			buildtables.py
 #		Date:			3rd September 2019
 #		Purpose:		Creates files tables.h from the .opcodes descriptors
+#						(one fused interpreter and instruction length table per
+#						CPU and register width state)
 #						Creates disassembly include file.
 #		Author:			Paul Robson (paul@robson.org.uk)
 #		Formatted By: 	Jeries Abedrabbo (jabedrabbo@asaltech.com)
@@ -32,15 +34,10 @@ OPCODE_REGEX_STR = "^(?P<{actnCode}>\\w+)\\s+(?P<{addrMode}>\\w+)\\s+(?P<{mchnCy
 
 #####################################
 ########## HEADER CONSTANTS #########
-ADDR_MODE_HEADER_C02 = "static void (*addrtable_c02[256])() = {"
-ACTN_CODE_HEADER_C02 = "static void (*optable_c02[256])() = {"
-MCHN_CYCLES_HEADER_C02 = "static const uint32_t ticktable_c02[256] = {"
 MNEMONICS_DISASSEM_HEADER_C02 = "static const char *mnemonics_c02[256] = {"
-ADDR_MODE_HEADER_C816 = "static void (*addrtable_c816[256])() = {"
-ACTN_CODE_HEADER_C816 = "static void (*optable_c816[256])() = {"
-MCHN_CYCLES_HEADER_C816 = "static const uint32_t ticktable_c816[256] = {"
 MNEMONICS_DISASSEM_HEADER_C816 = "static const char *mnemonics_c816[256] = {"
-TABLE_MAP = "/*{0:8}|  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |{0:5}*/\n"
+INTERPRETER_HEADER = "static void interpret_{}() {{"
+OPLENGTH_HEADER = "static const uint8_t oplength_{}[256] = {{"
 
 #####################################
 ######### OPCODE CONSTANTS ##########
@@ -50,6 +47,48 @@ EMPTY_NOP_MOD = "imp"
 OPCODE_ROW_LEN = 16
 TOTAL_NUMBER_OPCODES = 2 ** 8
 
+#####################################
+######### PENALTY CONSTANTS #########
+# Extra cycles that depend on the instruction/mode pair. These must be kept in
+# sync with the handlers in instructions.h, 65c02.h and modes.h.
+PENALTY_ADDR_MODES = ["absx", "abslx", "absy", "indy", "sridy"]     # page crossing (penaltyaddr)
+PENALTY_DP_MODES = ["zp", "zpx", "zpy", "ind0", "ind0p", "indl0", "indly", "indx", "indy"]  # DL != 0 (penaltyd)
+PENALTY_PAGE_ACTNS = ["adc", "and", "cmp", "eor", "lda", "ldx", "ldy", "ora", "sbc"]
+PENALTY_M_ACTNS = ["lda", "phx", "plx", "phy", "ply"]               # +1 with 16 bit accumulator
+PENALTY_X_ACTNS = ["ldx", "ldy"]                                    # +1 with 16 bit index
+PENALTY_N_ACTNS = ["brk", "cop"]                                    # +1 in native mode
+
+#####################################
+###### BLOCK DECODING CONSTANTS #####
+# Instruction length by address mode; immm/immx take one more byte with 16 bit M/X
+MODE_LENGTHS = {
+    "imp": 1, "imp8": 1, "acc": 1,
+    "imm8": 2, "immm": 2, "immx": 2, "zp": 2, "zpx": 2, "zpy": 2, "rel": 2, "sr": 2, "sridy": 2,
+    "ind0": 2, "ind0p": 2, "indl0": 2, "indly": 2, "indx": 2, "indy": 2,
+    "imm16": 3, "rel16": 3, "zprel": 3, "abso": 3, "absx": 3, "absy": 3,
+    "ind": 3, "aindl": 3, "ainx": 3, "bmv": 3,
+    "absl": 4, "abslx": 4,
+}
+# Instructions after which a decoded block ends: control transfers, WAI/STP and
+# everything that changes the register widths (and with them the instruction lengths)
+BLOCK_END_ACTNS = ["bcc", "bcs", "beq", "bmi", "bne", "bpl", "bvc", "bvs", "bra", "brl",
+                   "jmp", "jml", "jsr", "jsl", "rts", "rtl", "rti", "brk", "cop", "wai", "dbg",
+                   "mvn", "mvp", "rep", "sep", "xce", "plp"] + \
+                  ["bbr{}".format(i) for i in range(8)] + ["bbs{}".format(i) for i in range(8)]
+OPLENGTH_ENDS_BLOCK = 0x80
+
+#####################################
+###### REGISTER WIDTH CONSTANTS #####
+# Handler sets instantiated by fake6502.c: (suffix, e, 16 bit accumulator, 16 bit index)
+STATE_EMU = ("emu", True, False, False)
+STATES_C816 = [
+    STATE_EMU,
+    ("m16x16", False, True, True),
+    ("m16x8", False, True, False),
+    ("m8x16", False, False, True),
+    ("m8x8", False, False, False),
+]
+
 #####################################
 ############# FILENAMES #############
 TABLES_HEADER_FNAME = "tables.h"
@@ -103,27 +142,57 @@ def fillNop(opcodesList):
 
 
 #######################################################################################################################
-###################################################  Output a table  ##################################################
+##########################################  Output a fused interpreter switch  ########################################
 #######################################################################################################################
-def generateTable(hFileName, header, element, opcodesList):
-    spacing = 5
-    hFileName.write("{}{}{}".format("\n", header, "\n"))
-    hFileName.write(TABLE_MAP.format("", ""))
+def generateInterpreter(hFileName, name, state, opcodesList):
+    suffix, emulation, memory16, index16 = state
+    hFileName.write("{}{}{}".format("\n", INTERPRETER_HEADER.format(name), "\n"))
+    hFileName.write("    switch (opcode) {\n")
+    for opInfo in opcodesList:
+        mode = opInfo[MODE_KEY_STR]
+        action = opInfo[ACTN_KEY_STR]
+        cycles = int(opInfo[CYCLES_KEY_STR])
+        penalties = []
+        prologue = []
+
+        if action in PENALTY_PAGE_ACTNS and mode in PENALTY_ADDR_MODES:
+            prologue.append("penaltyaddr = 0;")
+            penalties.append("penaltyaddr")
+        if mode in PENALTY_DP_MODES:
+            prologue.append("penaltyd = 0;")
+            penalties.append("penaltyd")
+        if (action in PENALTY_M_ACTNS and memory16) or (action in PENALTY_X_ACTNS and index16) or \
+                (action in PENALTY_N_ACTNS and not emulation):
+            cycles += 1
+
+        hFileName.write("        case 0x{0:02X}: // {1} {2}\n".format(opInfo[OPCODE_KEY_STR], action, mode))
+        for line in prologue + ["{}_{}();".format(mode, suffix), "{}_{}();".format(action, suffix),
+                                "clockticks6502 += {};".format(" + ".join([str(cycles)] + penalties)), "break;"]:
+            hFileName.write("            {}\n".format(line))
+    hFileName.write("    }\n")
+    hFileName.write("}\n")
+
+
+#######################################################################################################################
+#########################################  Output an instruction length table  ########################################
+#######################################################################################################################
+def generateLengthTable(hFileName, name, state, opcodesList):
+    suffix, emulation, memory16, index16 = state
+    hFileName.write("{}{}{}".format("\n", OPLENGTH_HEADER.format(name), "\n"))
     for row in range(0, OPCODE_ROW_LEN):
-        elements = ",".join(
-            ["{0:>9}".format(opcodesList[opcodeItem][element])[-spacing:] for opcodeItem in
-             range(row * OPCODE_ROW_LEN, OPCODE_ROW_LEN * (row + 1))])
-
-        hFileName.write("/* {0:X} */ {3}  {1}{2} /* {0:X} */\n".format(
-            row,
-            elements,
-            " " if row == OPCODE_ROW_LEN - 1 else ",",
-            " " if element == ACTN_KEY_STR else "")
-        )
+        elements = []
+        for opInfo in opcodesList[row * OPCODE_ROW_LEN:(row + 1) * OPCODE_ROW_LEN]:
+            mode = opInfo[MODE_KEY_STR]
+            length = MODE_LENGTHS[mode]
+            if (mode == "immm" and memory16) or (mode == "immx" and index16):
+                length += 1
+            if opInfo[ACTN_KEY_STR] in BLOCK_END_ACTNS:
+                length |= OPLENGTH_ENDS_BLOCK
+            elements.append("0x{:02X}".format(length))
+        hFileName.write("    /* {:X} */ {}{}\n".format(row, ", ".join(elements), "" if row == OPCODE_ROW_LEN - 1 else ","))
     hFileName.write("};\n")
 
 
-
 #######################################################################################################################
 ###################################################  Output a list   ##################################################
 #######################################################################################################################
@@ -204,12 +273,11 @@ if __name__ == '__main__':
     # Create "TABLES_HEADER_FNAME" header file
     with open(TABLES_HEADER_FNAME, "w") as output_h_file:
         output_h_file.write("/* Generated by buildtables.py */\n")
-        generateTable(output_h_file, ADDR_MODE_HEADER_C02, MODE_KEY_STR, opcodesList_c02)
-        generateTable(output_h_file, ADDR_MODE_HEADER_C816, MODE_KEY_STR, opcodesList_c816)
-        generateTable(output_h_file, ACTN_CODE_HEADER_C02, ACTN_KEY_STR, opcodesList_c02)
-        generateTable(output_h_file, ACTN_CODE_HEADER_C816, ACTN_KEY_STR, opcodesList_c816)
-        generateTable(output_h_file, MCHN_CYCLES_HEADER_C02, CYCLES_KEY_STR, opcodesList_c02)
-        generateTable(output_h_file, MCHN_CYCLES_HEADER_C816, CYCLES_KEY_STR, opcodesList_c816)
+        generateInterpreter(output_h_file, "c02", STATE_EMU, opcodesList_c02)
+        generateLengthTable(output_h_file, "c02", STATE_EMU, opcodesList_c02)
+        for state in STATES_C816:
+            generateInterpreter(output_h_file, "c816_" + state[0], state, opcodesList_c816)
+            generateLengthTable(output_h_file, "c816_" + state[0], state, opcodesList_c816)
 
     # Create disassembly "MNEMONICS_DISASSEM_HEADER_FNAME" header file.
     mnemonics_c02 = [convertMnemonic(opcodesList_c02[x]) for x in range(0, TOTAL_NUMBER_OPCODES)]
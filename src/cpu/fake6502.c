@@ -61,12 +61,20 @@
  * void step6502()                                   *
  *   - Execute a single instrution.                  *
  *                                                   *
+ * uint32_t stepblock6502()                         *
+ *   - Execute a decoded block of instructions and   *
+ *     return how many were executed.                *
+ *                                                   *
  * void irq6502()                                    *
  *   - Trigger a hardware IRQ in the 6502 core.      *
  *                                                   *
  * void nmi6502()                                    *
  *   - Trigger an NMI in the 6502 core.              *
  *                                                   *
+ * void update6502mode()                             *
+ *   - Call after changing regs.status or regs.e     *
+ *     from outside the CPU core.                    *
+ *                                                   *
  * void hookexternal(void *funcptr)                  *
  *   - Pass a pointer to a void function taking no   *
  *     parameters. This will cause Fake6502 to call  *
@@ -88,31 +96,33 @@
 
 #include "registers.h"
 
-#include <stdio.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
+#include "../machine.h"
 
 // 6502 / 65816 registers
 
-struct regs regs;
+machine_local struct regs regs;
 
 //helper variables
-uint32_t instructions = 0; //keep track of total instructions executed
-uint32_t clockticks6502 = 0, clockgoal6502 = 0;
-uint16_t opcode_addr, oldpc, reladdr, value;
-uint32_t ea;
-uint32_t result;
-uint8_t opcode, oldstatus;
+machine_local uint32_t instructions = 0; //keep track of total instructions executed
+machine_local uint32_t clockticks6502 = 0, clockgoal6502 = 0;
+machine_local uint16_t opcode_addr, oldpc, reladdr, value;
+machine_local uint32_t ea;
+machine_local uint32_t result;
+machine_local uint8_t opcode, oldstatus;
 
 bool warn_rockwell = true;
 
-uint8_t penaltyop, penaltyaddr;
-uint8_t penaltym = 0;
-uint8_t penaltye = 0;
-uint8_t penaltyn = 0;
-uint8_t penaltyx = 0;
-uint8_t penaltyd = 0;
-uint8_t waiting = 0;
+machine_local uint8_t penaltyaddr = 0;
+machine_local uint8_t penaltyd = 0;
+machine_local uint8_t waiting = 0;
+
+// instruction bytes of the running decoded block, see blockcache.h
+static machine_local const uint8_t *fetchptr = NULL;
 
 //externally supplied functions
 extern uint8_t read6502(uint16_t address, uint8_t bank);
@@ -121,21 +131,16 @@ extern void stop6502(uint16_t address, uint8_t bank);
 extern void vp6502();
 extern uint8_t memory_get_ram_bank();
 extern uint8_t memory_get_rom_bank();
+extern const uint8_t *memory_code_pointer(uint16_t address, uint8_t bank, const uint32_t **version, const uint8_t **bankreg);
+extern machine_local uint32_t code_epoch;
 
-static void (*addrtable_c02[256])();
-static void (*addrtable_c816[256])();
-static void (*optable_c02[256])();
-static void (*optable_c816[256])();
+void update6502mode();
 
-static const uint32_t ticktable_c02[256];
-static const uint32_t ticktable_c816[256];
-
-static void (**addrtable)();
-static void (**optable)();
-static const uint32_t *ticktable;
+// Address mode markers, kept in ea above the 24 bit address space
+#define EA_BANK0_WRAP  0x01000000 // zp, zp,x and zp,y: the high byte wraps within bank 0
+#define EA_ACCUMULATOR 0x02000000 // operand is the accumulator
 
 #include "support.h"
-#include "modes.h"
 
 void rockwell_warning(const char *instruction) {
     uint8_t pc_bank;
@@ -159,7 +164,7 @@ void rockwell_warning(const char *instruction) {
 }
 
 static uint8_t wrappedBankByte(uint32_t addr) {
-    if (addrtable[opcode] == zp || addrtable[opcode] == zpx || addrtable[opcode] == zpy) {
+    if (addr & EA_BANK0_WRAP) {
         return 0;
     }
     else {
@@ -168,7 +173,7 @@ static uint8_t wrappedBankByte(uint32_t addr) {
 }
 
 static uint16_t getvalue(bool use16Bit) {
-    if (addrtable[opcode] == acc) {
+    if (ea == EA_ACCUMULATOR) {
         return use16Bit ? regs.c : (uint16_t)regs.a;
     } else if (use16Bit) {
         return ((uint16_t)read6502(ea, bank_byte(ea)) | ((uint16_t)read6502(ea+1, wrappedBankByte(ea)) << 8));
@@ -181,7 +186,7 @@ __attribute__((unused)) static uint16_t getvalue16() {
 }
 
 static void putvalue(uint16_t saveval, bool use16Bit) {
-    if (addrtable[opcode] == acc) {
+    if (ea == EA_ACCUMULATOR) {
         if (use16Bit) {
             regs.c = saveval;
         } else {
@@ -195,10 +200,79 @@ static void putvalue(uint16_t saveval, bool use16Bit) {
     }
 }
 
-#include "instructions.h"
-#include "65c02.h"
+// One set of handlers per register width state. The 65C02 shares the
+// emulation mode set, where is65c816 is only consulted for decimal mode timing.
+#define CPU_STATE emu
+#define CPU_E 1
+#define CPU_M16 0
+#define CPU_X16 0
+#include "handlers.h"
+
+#define CPU_STATE m16x16
+#define CPU_E 0
+#define CPU_M16 1
+#define CPU_X16 1
+#include "handlers.h"
+
+#define CPU_STATE m16x8
+#define CPU_E 0
+#define CPU_M16 1
+#define CPU_X16 0
+#include "handlers.h"
+
+#define CPU_STATE m8x16
+#define CPU_E 0
+#define CPU_M16 0
+#define CPU_X16 1
+#include "handlers.h"
+
+#define CPU_STATE m8x8
+#define CPU_E 0
+#define CPU_M16 0
+#define CPU_X16 0
+#include "handlers.h"
+
 #include "tables.h"
 
+static machine_local void (*interpret)() = interpret_c02;
+static machine_local const uint8_t *oplength = oplength_c02;
+
+// Select the interpreter matching the CPU type and the e/m/x flags. This has to be
+// called whenever those change: REP, SEP, XCE, PLP and RTI do it themselves, code
+// outside the CPU core that writes regs.status or regs.e must call it as well.
+void update6502mode() {
+    if (regs.e) {
+        regs.status |= FLAG_INDEX_WIDTH | FLAG_MEMORY_WIDTH;
+    }
+
+    if (!regs.is65c816) {
+        interpret = interpret_c02;
+        oplength = oplength_c02;
+    } else if (regs.e) {
+        interpret = interpret_c816_emu;
+        oplength = oplength_c816_emu;
+    } else {
+        switch (regs.status & (FLAG_MEMORY_WIDTH | FLAG_INDEX_WIDTH)) {
+            case 0:
+                interpret = interpret_c816_m16x16;
+                oplength = oplength_c816_m16x16;
+                break;
+            case FLAG_INDEX_WIDTH:
+                interpret = interpret_c816_m16x8;
+                oplength = oplength_c816_m16x8;
+                break;
+            case FLAG_MEMORY_WIDTH:
+                interpret = interpret_c816_m8x16;
+                oplength = oplength_c816_m8x16;
+                break;
+            default:
+                interpret = interpret_c816_m8x8;
+                oplength = oplength_c816_m8x8;
+                break;
+        }
+    }
+}
+
 void nmi6502() {
     interrupt6502(INT_NMI);
     waiting = 0;
@@ -214,44 +288,29 @@ void irq6502() {
 uint8_t callexternal = 0;
 void (*loopexternal)();
 
-void exec6502(uint32_t tickcount) {
-	if (waiting) {
-		clockticks6502 += tickcount;
-		clockgoal6502 = clockticks6502;
-		return;
-    }
-
+// Fetch and execute one instruction. The per-opcode bodies (address mode,
+// operation and cycle count including penalties) are generated into tables.h.
+static inline void execute6502() {
     opcode_addr = regs.pc;
 
-    clockgoal6502 += tickcount;
-
-    while (clockticks6502 < clockgoal6502) {
-        opcode = read6502(regs.pc++, regs.k);
-
-        if (regs.e) {
-            regs.status |= FLAG_INDEX_WIDTH | FLAG_MEMORY_WIDTH;
-        }
+    opcode = read6502(regs.pc++, regs.k);
 
-        penaltyop = 0;
-        penaltyaddr = 0;
-        penaltym = 0;
-        penaltye = 0;
-        penaltyn = 0;
-        penaltyx = 0;
+    (*interpret)();
 
-        (*addrtable[opcode])();
-        (*optable[opcode])();
-        clockticks6502 += ticktable[opcode];
+    instructions++;
 
-        if (!regs.e && penaltyop && penaltyaddr) clockticks6502++;
-        if (memory_16bit()) clockticks6502 += penaltym;
-        if (index_16bit()) clockticks6502 += penaltyx;
-        if (penaltyn && !regs.e) clockticks6502++;
-        if (penaltye && regs.e) clockticks6502++;
+    if (callexternal) (*loopexternal)();
+}
 
-        instructions++;
+void exec6502(uint32_t tickcount) {
+    clockgoal6502 += tickcount;
 
-        if (callexternal) (*loopexternal)();
+    while (clockticks6502 < clockgoal6502) {
+        if (waiting) {
+            clockticks6502 = clockgoal6502;
+            return;
+        }
+        execute6502();
     }
 }
 
@@ -262,38 +321,12 @@ void step6502() {
 		return;
 	}
 
-    opcode_addr = regs.pc;
-
-    opcode = read6502(regs.pc++, regs.k);
-
-    if (regs.e) {
-        regs.status |= FLAG_INDEX_WIDTH | FLAG_MEMORY_WIDTH;
-    }
-
-    penaltyop = 0;
-    penaltyaddr = 0;
-    penaltym = 0;
-    penaltye = 0;
-    penaltyn = 0;
-    penaltyx = 0;
-
-    (*addrtable[opcode])();
-    (*optable[opcode])();
-    clockticks6502 += ticktable[opcode];
-
-    if (penaltyop && penaltyaddr) clockticks6502++;
-    if (memory_16bit()) clockticks6502 += penaltym;
-    if (index_16bit()) clockticks6502 += penaltyx;
-    if (penaltyn && !regs.e) clockticks6502++;
-    if (penaltye && regs.e) clockticks6502++;
-    if (penaltyd) clockticks6502 ++;
+    execute6502();
     clockgoal6502 = clockticks6502;
-
-    instructions++;
-
-    if (callexternal) (*loopexternal)();
 }
 
+#include "blockcache.h"
+
 void hookexternal(void *funcptr) {
     if (funcptr != (void *)NULL) {
         loopexternal = funcptr;
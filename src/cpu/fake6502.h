@@ -6,14 +6,18 @@
 #define _FAKE6502_H_
 
 #include <stdint.h>
+#include "../machine.h"
 
 extern void reset6502(bool c816);
 extern void step6502();
+extern uint32_t stepblock6502();
+extern void freeblocks6502();
 extern void exec6502(uint32_t tickcount);
 extern void irq6502();
 extern void nmi6502();
-extern uint32_t clockticks6502;
-extern uint8_t waiting;
+extern void update6502mode();
+extern machine_local uint32_t clockticks6502;
+extern machine_local uint8_t waiting;
 extern bool warn_rockwell;
 
 #endif
@@ -0,0 +1,23 @@
+// *******************************************************************************************
+//
+//      Instantiates the address mode and instruction handlers for one register width state.
+//      Define CPU_STATE (the name suffix), CPU_E, CPU_M16 and CPU_X16 before including.
+//      Within the handlers emulation(), memory_16bit() and index_16bit() are constants, so
+//      the width tests are resolved at compile time.
+//
+// *******************************************************************************************
+
+// not every state uses every handler, e.g. the Rockwell instructions only exist on the 65C02
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+
+#include "modes.h"
+#include "instructions.h"
+#include "65c02.h"
+
+#pragma GCC diagnostic pop
+
+#undef CPU_STATE
+#undef CPU_E
+#undef CPU_M16
+#undef CPU_X16
@@ -13,8 +13,7 @@
 //
 //          instruction handler functions
 //
-static void adc() {
-    penaltyop = 1;
+static void FN(adc)() {
     if (regs.status & FLAG_DECIMAL) {
         uint16_t tmp, tmp2;
         uint32_t tmpov;
@@ -92,8 +91,7 @@ static void adc() {
     saveaccum(result);
 }
 
-static void and() {
-    penaltyop = 1;
+static void FN(and)() {
     value = getvalue(memory_16bit());
     result = acc_for_mode() & value;
 
@@ -103,7 +101,7 @@ static void and() {
     saveaccum(result);
 }
 
-static void asl() {
+static void FN(asl)() {
     value = getvalue(memory_16bit());
     result = value << 1;
 
@@ -114,29 +112,29 @@ static void asl() {
     putvalue(result, memory_16bit());
 }
 
-static void _do_branch(int condition) {
+static void FN(_do_branch)(int condition) {
     if (condition) {
         oldpc = regs.pc;
         regs.pc += reladdr;
         clockticks6502++;
-        if ((oldpc & 0xFF00) != (regs.pc & 0xFF00)) //check if jump crossed a page boundary
-            penaltye = 1;
+        if (emulation() && (oldpc & 0xFF00) != (regs.pc & 0xFF00)) //check if jump crossed a page boundary
+            clockticks6502++;
     }
 }
 
-static void bcc() {
-    _do_branch((regs.status & FLAG_CARRY) == 0);
+static void FN(bcc)() {
+    FN(_do_branch)((regs.status & FLAG_CARRY) == 0);
 }
 
-static void bcs() {
-    _do_branch((regs.status & FLAG_CARRY) == FLAG_CARRY);
+static void FN(bcs)() {
+    FN(_do_branch)((regs.status & FLAG_CARRY) == FLAG_CARRY);
 }
 
-static void beq() {
-    _do_branch((regs.status & FLAG_ZERO) == FLAG_ZERO);
+static void FN(beq)() {
+    FN(_do_branch)((regs.status & FLAG_ZERO) == FLAG_ZERO);
 }
 
-static void bit() {
+static void FN(bit)() {
     value = getvalue(memory_16bit());
     result = acc_for_mode() & value;
 
@@ -148,55 +146,53 @@ static void bit() {
     }
 }
 
-static void bmi() {
-    _do_branch((regs.status & FLAG_SIGN) == FLAG_SIGN);
+static void FN(bmi)() {
+    FN(_do_branch)((regs.status & FLAG_SIGN) == FLAG_SIGN);
 }
 
-static void bne() {
-    _do_branch((regs.status & FLAG_ZERO) == 0);
+static void FN(bne)() {
+    FN(_do_branch)((regs.status & FLAG_ZERO) == 0);
 }
 
-static void bpl() {
-    _do_branch((regs.status & FLAG_SIGN) == 0);
+static void FN(bpl)() {
+    FN(_do_branch)((regs.status & FLAG_SIGN) == 0);
 }
 
-static void brk() {
-    penaltyn = 1;
+static void FN(brk)() {
     regs.pc++;
 
     interrupt6502(INT_BRK);
 }
 
-static void brl() {
+static void FN(brl)() {
     regs.pc += reladdr;
 }
 
-static void bvc() {
-    _do_branch((regs.status & FLAG_OVERFLOW) == 0);
+static void FN(bvc)() {
+    FN(_do_branch)((regs.status & FLAG_OVERFLOW) == 0);
 }
 
-static void bvs() {
-    _do_branch((regs.status & FLAG_OVERFLOW) == FLAG_OVERFLOW);
+static void FN(bvs)() {
+    FN(_do_branch)((regs.status & FLAG_OVERFLOW) == FLAG_OVERFLOW);
 }
 
-static void clc() {
+static void FN(clc)() {
     clearcarry();
 }
 
-static void cld() {
+static void FN(cld)() {
     cleardecimal();
 }
 
-static void cli() {
+static void FN(cli)() {
     clearinterrupt();
 }
 
-static void clv() {
+static void FN(clv)() {
     clearoverflow();
 }
 
-static void cmp() {
-    penaltyop = 1;
+static void FN(cmp)() {
     value = getvalue(memory_16bit());
 
     if (memory_16bit()) {
@@ -216,14 +212,13 @@ static void cmp() {
     signcalc(result, memory_16bit());
 }
 
-static void cop() {
-    penaltyn = 1;
+static void FN(cop)() {
     regs.pc++;
 
     interrupt6502(INT_COP);
 }
 
-static void cpx() {
+static void FN(cpx)() {
     value = getvalue(index_16bit());
 
     if (index_16bit()) {
@@ -242,7 +237,7 @@ static void cpx() {
     signcalc(result, index_16bit());
 }
 
-static void cpy() {
+static void FN(cpy)() {
     value = getvalue(index_16bit());
 
     if (index_16bit()) {
@@ -261,7 +256,7 @@ static void cpy() {
     signcalc(result, index_16bit());
 }
 
-static void dec() {
+static void FN(dec)() {
     value = getvalue(memory_16bit());
     result = value - 1;
 
@@ -271,7 +266,7 @@ static void dec() {
     putvalue(result, memory_16bit());
 }
 
-static void dex() {
+static void FN(dex)() {
     if (index_16bit()) {
         regs.x--;
         zerocalc(regs.x, 1);
@@ -283,7 +278,7 @@ static void dex() {
     }
 }
 
-static void dey() {
+static void FN(dey)() {
     if (index_16bit()) {
         regs.y--;
         zerocalc(regs.y, 1);
@@ -295,8 +290,7 @@ static void dey() {
     }
 }
 
-static void eor() {
-    penaltyop = 1;
+static void FN(eor)() {
     value = getvalue(memory_16bit());
     result = acc_for_mode() ^ value;
 
@@ -306,7 +300,7 @@ static void eor() {
     saveaccum(result);
 }
 
-static void inc() {
+static void FN(inc)() {
     value = getvalue(memory_16bit());
     result = value + 1;
 
@@ -316,7 +310,7 @@ static void inc() {
     putvalue(result, memory_16bit());
 }
 
-static void inx() {
+static void FN(inx)() {
     if (index_16bit()) {
         regs.x++;
         zerocalc(regs.x, 1);
@@ -328,7 +322,7 @@ static void inx() {
     }
 }
 
-static void iny() {
+static void FN(iny)() {
     if (index_16bit()) {
         regs.y++;
         zerocalc(regs.y, 1);
@@ -340,31 +334,28 @@ static void iny() {
     }
 }
 
-static void jml() {
+static void FN(jml)() {
     regs.pc = ea & 0xFFFF;
     regs.k = ea >> 16;
 }
 
-static void jmp() {
+static void FN(jmp)() {
     regs.pc = ea;
 }
 
-static void jsr() {
+static void FN(jsr)() {
     push16(regs.pc - 1);
     regs.pc = ea;
 }
 
-static void jsl() {
+static void FN(jsl)() {
     push8(regs.k);
     push16(regs.pc - 1);
     regs.pc = ea & 0xFFFF;
     regs.k = ea >> 16;
 }
 
-static void lda() {
-    penaltyop = 1;
-    penaltym = 1;
-
+static void FN(lda)() {
     if (memory_16bit()) {
         regs.c = getvalue(1);
         zerocalc(regs.c, 1);
@@ -377,10 +368,7 @@ static void lda() {
     }
 }
 
-static void ldx() {
-    penaltyop = 1;
-    penaltyx = 1;
-
+static void FN(ldx)() {
     if (index_16bit()) {
         regs.x = getvalue(1);
         zerocalc(regs.x, 1);
@@ -393,10 +381,7 @@ static void ldx() {
     }
 }
 
-static void ldy() {
-    penaltyop = 1;
-    penaltyx = 1;
-
+static void FN(ldy)() {
     if (index_16bit()) {
         regs.y = getvalue(1);
         zerocalc(regs.y, 1);
@@ -408,7 +393,7 @@ static void ldy() {
     }
 }
 
-static void lsr() {
+static void FN(lsr)() {
     value = getvalue(memory_16bit());
     result = value >> 1;
 
@@ -420,7 +405,7 @@ static void lsr() {
     putvalue(result, memory_16bit());
 }
 
-static void nop() {
+static void FN(nop)() {
     switch (opcode) {
         case 0x1C:
         case 0x3C:
@@ -428,13 +413,11 @@ static void nop() {
         case 0x7C:
         case 0xDC:
         case 0xFC:
-            penaltyop = 1;
             break;
     }
 }
 
-static void ora() {
-    penaltyop = 1;
+static void FN(ora)() {
     value = getvalue(memory_16bit());
     result = acc_for_mode() | value;
 
@@ -444,19 +427,19 @@ static void ora() {
     saveaccum(result);
 }
 
-static void pea() {
+static void FN(pea)() {
     push16(getvalue(1));
 }
 
-static void pei() {
+static void FN(pei)() {
     push16(ea);
 }
 
-static void per() {
+static void FN(per)() {
     push16(regs.pc + reladdr);
 }
 
-static void pha() {
+static void FN(pha)() {
     if (memory_16bit()) {
         push16(regs.c);
     } else {
@@ -464,23 +447,23 @@ static void pha() {
     }
 }
 
-static void phb() {
+static void FN(phb)() {
     push8(regs.db);
 }
 
-static void phd() {
+static void FN(phd)() {
     push16(regs.dp);
 }
 
-static void phk() {
+static void FN(phk)() {
     push8(regs.k);
 }
 
-static void php() {
-    push8(regs.e ? regs.status | FLAG_BREAK : regs.status);
+static void FN(php)() {
+    push8(emulation() ? regs.status | FLAG_BREAK : regs.status);
 }
 
-static void pla() {
+static void FN(pla)() {
     if (memory_16bit()) {
         regs.c = pull16();
         zerocalc(regs.c, 1);
@@ -492,36 +475,38 @@ static void pla() {
     }
 }
 
-static void plb() {
+static void FN(plb)() {
     regs.db = pull8();
     zerocalc(regs.db, 0);
     signcalc(regs.db, 0);
 }
 
-static void pld() {
+static void FN(pld)() {
     regs.dp = pull16();
 }
 
-static void plp() {
+static void FN(plp)() {
     regs.status = pull8();
-    if (regs.e) {
+    if (emulation()) {
         regs.status |= FLAG_INDEX_WIDTH | FLAG_MEMORY_WIDTH;
     } else if (regs.status & FLAG_INDEX_WIDTH) {
         regs.xh = 0;
         regs.yh = 0;
     }
+    update6502mode();
 }
 
-static void rep() {
+static void FN(rep)() {
     value = getvalue(0);
     regs.status &= ~(value & 0xFF);
 
-    if (regs.e) {
+    if (emulation()) {
         regs.status |= FLAG_INDEX_WIDTH | FLAG_MEMORY_WIDTH;
     }
+    update6502mode();
 }
 
-static void rol() {
+static void FN(rol)() {
     value = getvalue(memory_16bit());
     result = (value << 1) | (regs.status & FLAG_CARRY);
 
@@ -532,7 +517,7 @@ static void rol() {
     putvalue(result, memory_16bit());
 }
 
-static void ror() {
+static void FN(ror)() {
     value = getvalue(memory_16bit());
     result = (value >> 1) | ((regs.status & FLAG_CARRY) << (memory_16bit() ? 15 : 7));
 
@@ -544,12 +529,12 @@ static void ror() {
     putvalue(result, memory_16bit());
 }
 
-static void rti() {
+static void FN(rti)() {
     regs.status = pull8();
     value = pull16();
     regs.pc = value;
 
-    if (regs.e) {
+    if (emulation()) {
         regs.status |= FLAG_INDEX_WIDTH | FLAG_MEMORY_WIDTH;
     } else {
         if (regs.status & FLAG_INDEX_WIDTH) {
@@ -558,21 +543,21 @@ static void rti() {
         }
         regs.k = pull8();
     }
+    update6502mode();
 }
 
-static void rtl() {
+static void FN(rtl)() {
     value = pull16();
     regs.pc = value + 1;
     regs.k = pull8();
 }
 
-static void rts() {
+static void FN(rts)() {
     value = pull16();
     regs.pc = value + 1;
 }
 
-static void sbc() {
-    penaltyop = 1;
+static void FN(sbc)() {
 
     if (regs.status & FLAG_DECIMAL) {
         uint16_t tmp, tmp2;
@@ -664,42 +649,43 @@ static void sbc() {
     saveaccum(result);
 }
 
-static void sec() {
+static void FN(sec)() {
     setcarry();
 }
 
-static void sed() {
+static void FN(sed)() {
     setdecimal();
 }
 
-static void sei() {
+static void FN(sei)() {
     setinterrupt();
 }
 
-static void sep() {
+static void FN(sep)() {
     regs.status |= getvalue(0) & 0xFF;
-    if (regs.e) {
+    if (emulation()) {
         regs.status |= FLAG_INDEX_WIDTH | FLAG_MEMORY_WIDTH;
     }
     if (regs.status & FLAG_INDEX_WIDTH) {
         regs.xh = 0;
         regs.yh = 0;
     }
+    update6502mode();
 }
 
-static void sta() {
+static void FN(sta)() {
     putvalue(acc_for_mode(), memory_16bit());
 }
 
-static void stx() {
+static void FN(stx)() {
     putvalue(index_16bit() ? regs.x : regs.xl, index_16bit());
 }
 
-static void sty() {
+static void FN(sty)() {
     putvalue(index_16bit() ? regs.y : regs.yl, index_16bit());
 }
 
-static void tax() {
+static void FN(tax)() {
     if (index_16bit()) {
         regs.x = regs.c; // 16 bits transferred, no matter the state of m
         zerocalc(regs.x, 1);
@@ -711,7 +697,7 @@ static void tax() {
     }
 }
 
-static void tay() {
+static void FN(tay)() {
     if (index_16bit()) {
         regs.y = regs.c; // 16 bits transferred, no matter the state of m
         zerocalc(regs.y, 1);
@@ -723,19 +709,19 @@ static void tay() {
     }
 }
 
-static void tcd() {
+static void FN(tcd)() {
     regs.dp = regs.c;
     zerocalc(regs.dp, 1);
     signcalc(regs.dp, 1);
 }
 
-static void tdc() {
+static void FN(tdc)() {
     regs.c = regs.dp;
     zerocalc(regs.c, 1);
     signcalc(regs.c, 1);
 }
 
-static void tsx() {
+static void FN(tsx)() {
     if (index_16bit()) {
         regs.x = regs.sp; // 16 bits transferred, no matter the state of m
         zerocalc(regs.x, 1);
@@ -748,7 +734,7 @@ static void tsx() {
     }
 }
 
-static void txa() {
+static void FN(txa)() {
     if (memory_16bit()) {
         if (index_16bit()) {
             regs.c = regs.x;
@@ -767,15 +753,15 @@ static void txa() {
     }
 }
 
-static void txs() {
-    if (regs.e) {
+static void FN(txs)() {
+    if (emulation()) {
         regs.sp = 0x100 | regs.xl;
     } else {
         regs.sp = regs.x;
     }
 }
 
-static void txy() {
+static void FN(txy)() {
     if (index_16bit()) {
         regs.y = regs.x;
         zerocalc(regs.y, 1);
@@ -787,7 +773,7 @@ static void txy() {
     }
 }
 
-static void tya() {
+static void FN(tya)() {
     if (memory_16bit()) {
         if (index_16bit()) {
             regs.c = regs.y;
@@ -806,7 +792,7 @@ static void tya() {
     }
 }
 
-static void tyx() {
+static void FN(tyx)() {
     if (index_16bit()) {
         regs.x = regs.y;
         zerocalc(regs.x, 1);
@@ -818,17 +804,17 @@ static void tyx() {
     }
 }
 
-static void tcs() {
+static void FN(tcs)() {
     regs.sp = regs.c;
 }
 
-static void tsc() {
+static void FN(tsc)() {
     regs.c = regs.sp;
     zerocalc(regs.c, 1);
     signcalc(regs.c, 1);
 }
 
-static void mvn() {
+static void FN(mvn)() {
     uint8_t sourceBank = ea >> 8;
     uint8_t destBank = ea;
     regs.db = destBank;
@@ -843,7 +829,7 @@ static void mvn() {
     }
 }
 
-static void mvp() {
+static void FN(mvp)() {
     uint8_t sourceBank = ea >> 8;
     uint8_t destBank = ea;
     regs.db = ea;
@@ -858,10 +844,10 @@ static void mvp() {
     }
 }
 
-static void wdm() {
+static void FN(wdm)() {
 }
 
-static void xba() {
+static void FN(xba)() {
     uint8_t tmp = regs.b;
     regs.b = regs.a;
     regs.a = tmp;
@@ -869,9 +855,9 @@ static void xba() {
     signcalc(regs.a, 0);
 }
 
-static void xce() {
+static void FN(xce)() {
     uint8_t carry = regs.status & FLAG_CARRY;
-    regs.status = (regs.status & ~FLAG_CARRY) | (regs.e ? FLAG_CARRY : 0);
+    regs.status = (regs.status & ~FLAG_CARRY) | (emulation() ? FLAG_CARRY : 0);
     regs.e = carry != 0;
 
     if (regs.e) {
@@ -880,4 +866,5 @@ static void xce() {
         regs.xh = 0x00;
         regs.yh = 0x00;
     }
+    update6502mode();
 }
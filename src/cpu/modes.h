@@ -12,20 +12,21 @@
 //                      A 6502 has a bug whereby if you jmp ($12FF) it reads the address from
 //                      $12FF and $1200. This has been fixed in the 65C02.
 //
-static void imp() { //implied
+static void FN(imp)() { //implied
 }
 
-static void imp8() { // brk / cop
+static void FN(imp8)() { // brk / cop
 }
 
-static void acc() { //accumulator
+static void FN(acc)() { //accumulator
+    ea = EA_ACCUMULATOR;
 }
 
-static void imm8() { //immediate, 8bit
+static void FN(imm8)() { //immediate, 8bit
     ea = addr_with_k(regs.pc++);
 }
 
-static void immm() { //immediate, 16bit if M = 0
+static void FN(immm)() { //immediate, 16bit if M = 0
     ea = addr_with_k(regs.pc++);
 
     if (memory_16bit()) {
@@ -33,7 +34,7 @@ static void immm() { //immediate, 16bit if M = 0
     }
 }
 
-static void immx() { //immediate, 16bit if X = 0
+static void FN(immx)() { //immediate, 16bit if X = 0
     ea = addr_with_k(regs.pc++);
 
     if (index_16bit()) {
@@ -41,24 +42,24 @@ static void immx() { //immediate, 16bit if X = 0
     }
 }
 
-static void imm16() {
+static void FN(imm16)() {
     ea = addr_with_k(regs.pc);
     regs.pc += 2;
 }
 
-static void _zp_with_offset(uint16_t offset) {
-    uint16_t imm_value = (uint16_t) read6502((uint16_t)regs.pc++, regs.k);
+static void FN(_zp_with_offset)(uint16_t offset) {
+    uint16_t imm_value = (uint16_t) fetch6502(regs.pc++);
 
     if (regs.dp & 0x00FF) {
         penaltyd = 1;
     }
 
-    ea = direct_page_add(imm_value + offset);
+    ea = direct_page_add(imm_value + offset) | EA_BANK0_WRAP;
 }
 
-static void _zp_long_with_offset(uint16_t offset) {
+static void FN(_zp_long_with_offset)(uint16_t offset) {
     uint16_t eahelp;
-    eahelp = (uint16_t)read6502(regs.pc++, regs.k);
+    eahelp = (uint16_t)fetch6502(regs.pc++);
 
     ea = (uint32_t)read6502(direct_page_add(eahelp), 0) | ((uint32_t)read6502(direct_page_add(eahelp + 1), 0) << 8) | ((uint32_t)read6502(direct_page_add(eahelp + 2), 0) << 16);
     ea = mask_long_addr(ea + offset);
@@ -68,41 +69,41 @@ static void _zp_long_with_offset(uint16_t offset) {
     }
 }
 
-static void zp() { //zero-page
-    _zp_with_offset(0);
+static void FN(zp)() { //zero-page
+    FN(_zp_with_offset)(0);
 }
 
-static void zpx() { //zero-page,X
-    _zp_with_offset(regs.x);
+static void FN(zpx)() { //zero-page,X
+    FN(_zp_with_offset)(regs.x);
 }
 
-static void zpy() { //zero-page,Y
-    _zp_with_offset(regs.y);
+static void FN(zpy)() { //zero-page,Y
+    FN(_zp_with_offset)(regs.y);
 }
 
-static void rel() { //relative for branch ops (8-bit immediate value, sign-extended)
-    reladdr = (uint16_t)read6502(regs.pc++, regs.k);
+static void FN(rel)() { //relative for branch ops (8-bit immediate value, sign-extended)
+    reladdr = (uint16_t)fetch6502(regs.pc++);
     if (reladdr & 0x80) reladdr |= 0xFF00;
 }
 
-static void rel16() { //relative for PER and BRL (16-bit immediate value)
-    reladdr = (uint16_t)read6502(regs.pc, regs.k) | ((uint16_t)read6502(regs.pc+1, regs.k) << 8);
+static void FN(rel16)() { //relative for PER and BRL (16-bit immediate value)
+    reladdr = (uint16_t)fetch6502(regs.pc) | ((uint16_t)fetch6502(regs.pc+1) << 8);
     regs.pc += 2;
 }
 
-static void abso() { //absolute
-    ea = addr_with_db((uint16_t) read6502(regs.pc, regs.k) | ((uint16_t)read6502(regs.pc+1, regs.k) << 8));
+static void FN(abso)() { //absolute
+    ea = addr_with_db((uint16_t) fetch6502(regs.pc) | ((uint16_t)fetch6502(regs.pc+1) << 8));
     regs.pc += 2;
 }
 
-static void absl() { // absolute long
-    ea = (uint32_t) read6502(regs.pc, regs.k) | ((uint32_t)read6502(regs.pc+1, regs.k) << 8) | ((uint32_t)read6502(regs.pc+2, regs.k) << 16);
+static void FN(absl)() { // absolute long
+    ea = (uint32_t) fetch6502(regs.pc) | ((uint32_t)fetch6502(regs.pc+1) << 8) | ((uint32_t)fetch6502(regs.pc+2) << 16);
     regs.pc += 3;
 }
 
-static void absx() { //absolute,X
+static void FN(absx)() { //absolute,X
     uint16_t startpage;
-    ea = addr_with_db((uint16_t)read6502(regs.pc, regs.k) | ((uint16_t)read6502(regs.pc+1, regs.k) << 8));
+    ea = addr_with_db((uint16_t)fetch6502(regs.pc) | ((uint16_t)fetch6502(regs.pc+1) << 8));
     startpage = ea & 0xFF00;
     ea = mask_long_addr(ea + regs.x);
 
@@ -113,9 +114,9 @@ static void absx() { //absolute,X
     regs.pc += 2;
 }
 
-static void abslx() { // absolute long, X
+static void FN(abslx)() { // absolute long, X
     uint16_t startpage;
-    ea = (uint32_t)read6502(regs.pc, regs.k) | ((uint32_t)read6502(regs.pc+1, regs.k) << 8) | ((uint32_t)read6502(regs.pc+2, regs.k) << 16);
+    ea = (uint32_t)fetch6502(regs.pc) | ((uint32_t)fetch6502(regs.pc+1) << 8) | ((uint32_t)fetch6502(regs.pc+2) << 16);
     startpage = ea & 0xFF00;
     ea = mask_long_addr(ea + regs.x);
 
@@ -126,9 +127,9 @@ static void abslx() { // absolute long, X
     regs.pc += 3;
 }
 
-static void absy() { //absolute,Y
+static void FN(absy)() { //absolute,Y
     uint16_t startpage;
-    ea = addr_with_db((uint16_t)read6502(regs.pc, regs.k) | ((uint16_t)read6502(regs.pc+1, regs.k) << 8));
+    ea = addr_with_db((uint16_t)fetch6502(regs.pc) | ((uint16_t)fetch6502(regs.pc+1) << 8));
     startpage = ea & 0xFF00;
     ea = mask_long_addr(ea + regs.y);
 
@@ -139,9 +140,9 @@ static void absy() { //absolute,Y
     regs.pc += 2;
 }
 
-static void ind() { //indirect - used for jmp, which assumes the pointer is in bank 0!
+static void FN(ind)() { //indirect - used for jmp, which assumes the pointer is in bank 0!
     uint16_t eahelp, eahelp2;
-    eahelp = (uint16_t)read6502(regs.pc, regs.k) | (uint16_t)((uint16_t)read6502(regs.pc+1, regs.k) << 8);
+    eahelp = (uint16_t)fetch6502(regs.pc) | (uint16_t)((uint16_t)fetch6502(regs.pc+1) << 8);
     //
     //      The 6502 page boundary wraparound bug does not occur on a 65C02.
     //
@@ -151,17 +152,17 @@ static void ind() { //indirect - used for jmp, which assumes the pointer is in b
     regs.pc += 2;
 }
 
-static void aindl() { // [addr]    uint16_t eahelp, eahelp2;
+static void FN(aindl)() { // [addr]    uint16_t eahelp, eahelp2;
     uint16_t eahelp, eahelp2;
-    eahelp = (uint16_t)read6502(regs.pc, regs.k) | (uint16_t)((uint16_t)read6502(regs.pc+1, regs.k) << 8);
+    eahelp = (uint16_t)fetch6502(regs.pc) | (uint16_t)((uint16_t)fetch6502(regs.pc+1) << 8);
     eahelp2 = (eahelp+1) & 0xFFFF;
     ea = (uint32_t)read6502(eahelp, 0) | ((uint32_t)read6502(eahelp2, 0) << 8) | ((uint16_t)read6502((eahelp2 + 1) & 0xFFFF, 0) << 16);
     regs.pc += 2;
 }
 
-static void ind0() { // (zp)
+static void FN(ind0)() { // (zp)
     uint16_t eahelp;
-    eahelp = (uint16_t)read6502(regs.pc++, regs.k);
+    eahelp = (uint16_t)fetch6502(regs.pc++);
     ea = (uint16_t)read6502(direct_page_add(eahelp), 0) | ((uint16_t)read6502(direct_page_add(eahelp + 1), 0) << 8);
 
     if (regs.dp & 0x00FF) {
@@ -169,13 +170,13 @@ static void ind0() { // (zp)
     }
 }
 
-static void indl0() { // [dp]
-    _zp_long_with_offset(0);
+static void FN(indl0)() { // [dp]
+    FN(_zp_long_with_offset)(0);
 }
 
-static void indx() { // (indirect,X)
+static void FN(indx)() { // (indirect,X)
     uint16_t eahelp;
-    eahelp = (uint16_t)read6502(regs.pc++, regs.k) + regs.x;
+    eahelp = (uint16_t)fetch6502(regs.pc++) + regs.x;
     ea = (uint16_t)read6502(direct_page_add(eahelp), 0) | ((uint16_t)read6502(direct_page_add(eahelp + 1), 0) << 8);
 
     if (regs.dp & 0x00FF) {
@@ -183,9 +184,9 @@ static void indx() { // (indirect,X)
     }
 }
 
-static void indy() { // (indirect),Y
+static void FN(indy)() { // (indirect),Y
     uint16_t eahelp, startpage;
-    eahelp = (uint16_t)read6502(regs.pc++, regs.k);
+    eahelp = (uint16_t)fetch6502(regs.pc++);
     ea = (uint16_t)read6502(direct_page_add(eahelp), 0) | ((uint16_t)read6502(direct_page_add(eahelp + 1), 0) << 8);
     startpage = ea & 0xFF00;
     ea += regs.y;
@@ -199,13 +200,13 @@ static void indy() { // (indirect),Y
     }
 }
 
-static void indly() { // [dp],Y
-    _zp_long_with_offset(regs.y);
+static void FN(indly)() { // [dp],Y
+    FN(_zp_long_with_offset)(regs.y);
 }
 
-static void ind0p() { // (zp) used by PEI, which doesn't do wraparound calculations
+static void FN(ind0p)() { // (zp) used by PEI, which doesn't do wraparound calculations
     uint16_t eahelp;
-    eahelp = (uint16_t)read6502(regs.pc++, regs.k);
+    eahelp = (uint16_t)fetch6502(regs.pc++);
     ea = (uint16_t)read6502(regs.dp + eahelp, 0) | ((uint16_t)read6502(regs.dp + eahelp + 1, 0) << 8);
 
     if (regs.dp & 0x00FF) {
@@ -213,21 +214,21 @@ static void ind0p() { // (zp) used by PEI, which doesn't do wraparound calculati
     }
 }
 
-static void zprel() { // zero-page, relative for branch ops (8-bit immediatel value, sign-extended) - only used for the 65C02's Rockwell extensions
-	ea = (uint16_t)read6502(regs.pc, 0);
-	reladdr = (uint16_t)read6502(regs.pc+1, 0);
+static void FN(zprel)() { // zero-page, relative for branch ops (8-bit immediatel value, sign-extended) - only used for the 65C02's Rockwell extensions
+	ea = (uint16_t)fetch6502(regs.pc);
+	reladdr = (uint16_t)fetch6502(regs.pc+1);
 	if (reladdr & 0x80) reladdr |= 0xFF00;
 
 	regs.pc += 2;
 }
 
-static void sr() { // absolute,S
-    ea = regs.sp + (uint16_t)read6502(regs.pc++, regs.k);
+static void FN(sr)() { // absolute,S
+    ea = regs.sp + (uint16_t)fetch6502(regs.pc++);
 }
 
-static void sridy() { // (indirect,S),Y
+static void FN(sridy)() { // (indirect,S),Y
     uint16_t eahelp, startpage;
-    eahelp = regs.sp + (uint16_t)read6502(regs.pc++, regs.k);
+    eahelp = regs.sp + (uint16_t)fetch6502(regs.pc++);
     ea = (uint16_t)read6502(eahelp, 0) | ((uint16_t)read6502(eahelp + 1, 0) << 8);
     startpage = ea & 0xFF00;
     ea += (uint16_t)regs.y;
@@ -237,7 +238,7 @@ static void sridy() { // (indirect,S),Y
     }
 }
 
-static void bmv() { // block move
-    uint8_t dest = read6502(regs.pc++, regs.k);
-    ea = (read6502(regs.pc++, regs.k) << 8) | dest;
+static void FN(bmv)() { // block move
+    uint8_t dest = fetch6502(regs.pc++);
+    ea = (fetch6502(regs.pc++) << 8) | dest;
 }
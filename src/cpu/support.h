@@ -55,8 +55,15 @@
         else clearoverflow();\
 }
 
-#define index_16bit() (regs.is65c816 && !(regs.status & FLAG_INDEX_WIDTH))
-#define memory_16bit() (regs.is65c816 && !(regs.status & FLAG_MEMORY_WIDTH))
+//register width state of the handler set being compiled (see handlers.h)
+#define emulation() (CPU_E)
+#define index_16bit() (CPU_X16)
+#define memory_16bit() (CPU_M16)
+
+//handler names carry the suffix of their register width state, e.g. FN(lda) -> lda_m8x16
+#define FN(name) FN_STATE(name, CPU_STATE)
+#define FN_STATE(name, state) FN_PASTE(name, state)
+#define FN_PASTE(name, state) name##_##state
 #define acc_for_mode() (memory_16bit() ? regs.c : ((uint16_t) regs.a))
 
 
@@ -150,19 +157,14 @@ void reset6502(bool c816) {
     if (c816) {
         regs.status |= FLAG_INDEX_WIDTH | FLAG_MEMORY_WIDTH;
         regs.is65c816 = true;
-        ticktable = ticktable_c816;
-        optable = optable_c816;
-        addrtable = addrtable_c816;
     } else {
         regs.status |= FLAG_CONSTANT;
         regs.is65c816 = false;
-        ticktable = ticktable_c02;
-        optable = optable_c02;
-        addrtable = addrtable_c02;
     }
     setinterrupt();
     cleardecimal();
     waiting = 0;
+    update6502mode();
 }
 
 enum InterruptType {
@@ -209,3 +211,11 @@ static uint32_t addr_with_db(uint16_t addr) {
 static uint32_t addr_with_k(uint16_t addr) {
     return mask_long_addr(as_bank_byte(regs.k) | addr);
 }
+
+// instruction stream (operand) bytes; while a decoded block executes they come from the block
+static uint8_t fetch6502(uint16_t address) {
+    if (fetchptr) {
+        return fetchptr[(uint16_t)(address - opcode_addr)];
+    }
+    return read6502(address, regs.k);
+}
@@ -1,121 +1,8542 @@
 /* Generated by buildtables.py */
 
-static void (*addrtable_c02[256])() = {
-/*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
-/* 0 */    imp8, indx, imm8,  imp,   zp,   zp,   zp,   zp,  imp, immm,  acc,  imp, abso, abso, abso,zprel, /* 0 */
-/* 1 */     rel, indy, ind0,  imp,   zp,  zpx,  zpx,   zp,  imp, absy,  acc,  imp, abso, absx, absx,zprel, /* 1 */
-/* 2 */    abso, indx, imm8,  imp,   zp,   zp,   zp,   zp,  imp, immm,  acc,  imp, abso, abso, abso,zprel, /* 2 */
-/* 3 */     rel, indy, ind0,  imp,  zpx,  zpx,  zpx,   zp,  imp, absy,  acc,  imp, absx, absx, absx,zprel, /* 3 */
-/* 4 */     imp, indx, imm8,  imp, imm8,   zp,   zp,   zp,  imp, immm,  acc,  imp, abso, abso, abso,zprel, /* 4 */
-/* 5 */     rel, indy, ind0,  imp, imm8,  zpx,  zpx,   zp,  imp, absy,  imp,  imp,  imp, absx, absx,zprel, /* 5 */
-/* 6 */     imp, indx, imm8,  imp,   zp,   zp,   zp,   zp,  imp, immm,  acc,  imp,  ind, abso, abso,zprel, /* 6 */
-/* 7 */     rel, indy, ind0,  imp,  zpx,  zpx,  zpx,   zp,  imp, absy,  imp,  imp, ainx, absx, absx,zprel, /* 7 */
-/* 8 */     rel, indx, imm8,  imp,   zp,   zp,   zp,   zp,  imp, immm,  imp,  imp, abso, abso, abso,zprel, /* 8 */
-/* 9 */     rel, indy, ind0,  imp,  zpx,  zpx,  zpy,   zp,  imp, absy,  imp,  imp, abso, absx, absx,zprel, /* 9 */
-/* A */    immx, indx, immx,  imp,   zp,   zp,   zp,   zp,  imp, immm,  imp,  imp, abso, abso, abso,zprel, /* A */
-/* B */     rel, indy, ind0,  imp,  zpx,  zpx,  zpy,   zp,  imp, absy,  imp,  imp, absx, absx, absy,zprel, /* B */
-/* C */    immx, indx, imm8,  imp,   zp,   zp,   zp,   zp,  imp, immm,  imp,  imp, abso, abso, abso,zprel, /* C */
-/* D */     rel, indy, ind0,  imp, imm8,  zpx,  zpx,   zp,  imp, absy,  imp,  imp,  imp, absx, absx,zprel, /* D */
-/* E */    immx, indx, imm8,  imp,   zp,   zp,   zp,   zp,  imp, immm,  imp,  imp, abso, abso, abso,zprel, /* E */
-/* F */     rel, indy, ind0,  imp, imm8,  zpx,  zpx,   zp,  imp, absy,  imp,  imp,  imp, absx, absx,zprel  /* F */
+static void interpret_c02() {
+    switch (opcode) {
+        case 0x00: // brk imp8
+            imp8_emu();
+            brk_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x01: // ora indx
+            penaltyd = 0;
+            indx_emu();
+            ora_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x02: // nop imm8
+            imm8_emu();
+            nop_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x03: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x04: // tsb zp
+            penaltyd = 0;
+            zp_emu();
+            tsb_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x05: // ora zp
+            penaltyd = 0;
+            zp_emu();
+            ora_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x06: // asl zp
+            penaltyd = 0;
+            zp_emu();
+            asl_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x07: // rmb0 zp
+            penaltyd = 0;
+            zp_emu();
+            rmb0_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x08: // php imp
+            imp_emu();
+            php_emu();
+            clockticks6502 += 3;
+            break;
+        case 0x09: // ora immm
+            immm_emu();
+            ora_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x0A: // asl acc
+            acc_emu();
+            asl_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x0B: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x0C: // tsb abso
+            abso_emu();
+            tsb_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x0D: // ora abso
+            abso_emu();
+            ora_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x0E: // asl abso
+            abso_emu();
+            asl_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x0F: // bbr0 zprel
+            zprel_emu();
+            bbr0_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x10: // bpl rel
+            rel_emu();
+            bpl_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x11: // ora indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            ora_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x12: // ora ind0
+            penaltyd = 0;
+            ind0_emu();
+            ora_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x13: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x14: // trb zp
+            penaltyd = 0;
+            zp_emu();
+            trb_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x15: // ora zpx
+            penaltyd = 0;
+            zpx_emu();
+            ora_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x16: // asl zpx
+            penaltyd = 0;
+            zpx_emu();
+            asl_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x17: // rmb1 zp
+            penaltyd = 0;
+            zp_emu();
+            rmb1_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x18: // clc imp
+            imp_emu();
+            clc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x19: // ora absy
+            penaltyaddr = 0;
+            absy_emu();
+            ora_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x1A: // inc acc
+            acc_emu();
+            inc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x1B: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x1C: // trb abso
+            abso_emu();
+            trb_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x1D: // ora absx
+            penaltyaddr = 0;
+            absx_emu();
+            ora_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x1E: // asl absx
+            absx_emu();
+            asl_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x1F: // bbr1 zprel
+            zprel_emu();
+            bbr1_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x20: // jsr abso
+            abso_emu();
+            jsr_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x21: // and indx
+            penaltyd = 0;
+            indx_emu();
+            and_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x22: // nop imm8
+            imm8_emu();
+            nop_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x23: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x24: // bit zp
+            penaltyd = 0;
+            zp_emu();
+            bit_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x25: // and zp
+            penaltyd = 0;
+            zp_emu();
+            and_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x26: // rol zp
+            penaltyd = 0;
+            zp_emu();
+            rol_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x27: // rmb2 zp
+            penaltyd = 0;
+            zp_emu();
+            rmb2_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x28: // plp imp
+            imp_emu();
+            plp_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x29: // and immm
+            immm_emu();
+            and_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x2A: // rol acc
+            acc_emu();
+            rol_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x2B: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x2C: // bit abso
+            abso_emu();
+            bit_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x2D: // and abso
+            abso_emu();
+            and_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x2E: // rol abso
+            abso_emu();
+            rol_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x2F: // bbr2 zprel
+            zprel_emu();
+            bbr2_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x30: // bmi rel
+            rel_emu();
+            bmi_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x31: // and indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            and_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x32: // and ind0
+            penaltyd = 0;
+            ind0_emu();
+            and_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x33: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x34: // bit zpx
+            penaltyd = 0;
+            zpx_emu();
+            bit_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x35: // and zpx
+            penaltyd = 0;
+            zpx_emu();
+            and_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x36: // rol zpx
+            penaltyd = 0;
+            zpx_emu();
+            rol_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x37: // rmb3 zp
+            penaltyd = 0;
+            zp_emu();
+            rmb3_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x38: // sec imp
+            imp_emu();
+            sec_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x39: // and absy
+            penaltyaddr = 0;
+            absy_emu();
+            and_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x3A: // dec acc
+            acc_emu();
+            dec_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x3B: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x3C: // bit absx
+            absx_emu();
+            bit_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x3D: // and absx
+            penaltyaddr = 0;
+            absx_emu();
+            and_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x3E: // rol absx
+            absx_emu();
+            rol_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x3F: // bbr3 zprel
+            zprel_emu();
+            bbr3_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x40: // rti imp
+            imp_emu();
+            rti_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x41: // eor indx
+            penaltyd = 0;
+            indx_emu();
+            eor_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x42: // nop imm8
+            imm8_emu();
+            nop_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x43: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x44: // nop imm8
+            imm8_emu();
+            nop_emu();
+            clockticks6502 += 3;
+            break;
+        case 0x45: // eor zp
+            penaltyd = 0;
+            zp_emu();
+            eor_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x46: // lsr zp
+            penaltyd = 0;
+            zp_emu();
+            lsr_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x47: // rmb4 zp
+            penaltyd = 0;
+            zp_emu();
+            rmb4_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x48: // pha imp
+            imp_emu();
+            pha_emu();
+            clockticks6502 += 3;
+            break;
+        case 0x49: // eor immm
+            immm_emu();
+            eor_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x4A: // lsr acc
+            acc_emu();
+            lsr_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x4B: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x4C: // jmp abso
+            abso_emu();
+            jmp_emu();
+            clockticks6502 += 3;
+            break;
+        case 0x4D: // eor abso
+            abso_emu();
+            eor_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x4E: // lsr abso
+            abso_emu();
+            lsr_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x4F: // bbr4 zprel
+            zprel_emu();
+            bbr4_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x50: // bvc rel
+            rel_emu();
+            bvc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x51: // eor indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            eor_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x52: // eor ind0
+            penaltyd = 0;
+            ind0_emu();
+            eor_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x53: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x54: // nop imm8
+            imm8_emu();
+            nop_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x55: // eor zpx
+            penaltyd = 0;
+            zpx_emu();
+            eor_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x56: // lsr zpx
+            penaltyd = 0;
+            zpx_emu();
+            lsr_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x57: // rmb5 zp
+            penaltyd = 0;
+            zp_emu();
+            rmb5_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x58: // cli imp
+            imp_emu();
+            cli_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x59: // eor absy
+            penaltyaddr = 0;
+            absy_emu();
+            eor_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x5A: // phy imp
+            imp_emu();
+            phy_emu();
+            clockticks6502 += 3;
+            break;
+        case 0x5B: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x5C: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 8;
+            break;
+        case 0x5D: // eor absx
+            penaltyaddr = 0;
+            absx_emu();
+            eor_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x5E: // lsr absx
+            absx_emu();
+            lsr_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x5F: // bbr5 zprel
+            zprel_emu();
+            bbr5_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x60: // rts imp
+            imp_emu();
+            rts_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x61: // adc indx
+            penaltyd = 0;
+            indx_emu();
+            adc_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x62: // nop imm8
+            imm8_emu();
+            nop_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x63: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x64: // stz zp
+            penaltyd = 0;
+            zp_emu();
+            stz_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x65: // adc zp
+            penaltyd = 0;
+            zp_emu();
+            adc_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x66: // ror zp
+            penaltyd = 0;
+            zp_emu();
+            ror_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x67: // rmb6 zp
+            penaltyd = 0;
+            zp_emu();
+            rmb6_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x68: // pla imp
+            imp_emu();
+            pla_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x69: // adc immm
+            immm_emu();
+            adc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x6A: // ror acc
+            acc_emu();
+            ror_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x6B: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x6C: // jmp ind
+            ind_emu();
+            jmp_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x6D: // adc abso
+            abso_emu();
+            adc_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x6E: // ror abso
+            abso_emu();
+            ror_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x6F: // bbr6 zprel
+            zprel_emu();
+            bbr6_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x70: // bvs rel
+            rel_emu();
+            bvs_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x71: // adc indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            adc_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x72: // adc ind0
+            penaltyd = 0;
+            ind0_emu();
+            adc_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x73: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x74: // stz zpx
+            penaltyd = 0;
+            zpx_emu();
+            stz_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x75: // adc zpx
+            penaltyd = 0;
+            zpx_emu();
+            adc_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x76: // ror zpx
+            penaltyd = 0;
+            zpx_emu();
+            ror_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x77: // rmb7 zp
+            penaltyd = 0;
+            zp_emu();
+            rmb7_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x78: // sei imp
+            imp_emu();
+            sei_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x79: // adc absy
+            penaltyaddr = 0;
+            absy_emu();
+            adc_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x7A: // ply imp
+            imp_emu();
+            ply_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x7B: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x7C: // jmp ainx
+            ainx_emu();
+            jmp_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x7D: // adc absx
+            penaltyaddr = 0;
+            absx_emu();
+            adc_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x7E: // ror absx
+            absx_emu();
+            ror_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x7F: // bbr7 zprel
+            zprel_emu();
+            bbr7_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x80: // bra rel
+            rel_emu();
+            bra_emu();
+            clockticks6502 += 3;
+            break;
+        case 0x81: // sta indx
+            penaltyd = 0;
+            indx_emu();
+            sta_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x82: // nop imm8
+            imm8_emu();
+            nop_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x83: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x84: // sty zp
+            penaltyd = 0;
+            zp_emu();
+            sty_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x85: // sta zp
+            penaltyd = 0;
+            zp_emu();
+            sta_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x86: // stx zp
+            penaltyd = 0;
+            zp_emu();
+            stx_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x87: // smb0 zp
+            penaltyd = 0;
+            zp_emu();
+            smb0_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x88: // dey imp
+            imp_emu();
+            dey_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x89: // bit immm
+            immm_emu();
+            bit_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x8A: // txa imp
+            imp_emu();
+            txa_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x8B: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x8C: // sty abso
+            abso_emu();
+            sty_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x8D: // sta abso
+            abso_emu();
+            sta_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x8E: // stx abso
+            abso_emu();
+            stx_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x8F: // bbs0 zprel
+            zprel_emu();
+            bbs0_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x90: // bcc rel
+            rel_emu();
+            bcc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x91: // sta indy
+            penaltyd = 0;
+            indy_emu();
+            sta_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x92: // sta ind0
+            penaltyd = 0;
+            ind0_emu();
+            sta_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x93: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x94: // sty zpx
+            penaltyd = 0;
+            zpx_emu();
+            sty_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x95: // sta zpx
+            penaltyd = 0;
+            zpx_emu();
+            sta_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x96: // stx zpy
+            penaltyd = 0;
+            zpy_emu();
+            stx_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x97: // smb1 zp
+            penaltyd = 0;
+            zp_emu();
+            smb1_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x98: // tya imp
+            imp_emu();
+            tya_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x99: // sta absy
+            absy_emu();
+            sta_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x9A: // txs imp
+            imp_emu();
+            txs_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x9B: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0x9C: // stz abso
+            abso_emu();
+            stz_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x9D: // sta absx
+            absx_emu();
+            sta_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x9E: // stz absx
+            absx_emu();
+            stz_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x9F: // bbs1 zprel
+            zprel_emu();
+            bbs1_emu();
+            clockticks6502 += 5;
+            break;
+        case 0xA0: // ldy immx
+            immx_emu();
+            ldy_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xA1: // lda indx
+            penaltyd = 0;
+            indx_emu();
+            lda_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xA2: // ldx immx
+            immx_emu();
+            ldx_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xA3: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0xA4: // ldy zp
+            penaltyd = 0;
+            zp_emu();
+            ldy_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xA5: // lda zp
+            penaltyd = 0;
+            zp_emu();
+            lda_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xA6: // ldx zp
+            penaltyd = 0;
+            zp_emu();
+            ldx_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xA7: // smb2 zp
+            penaltyd = 0;
+            zp_emu();
+            smb2_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xA8: // tay imp
+            imp_emu();
+            tay_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xA9: // lda immm
+            immm_emu();
+            lda_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xAA: // tax imp
+            imp_emu();
+            tax_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xAB: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0xAC: // ldy abso
+            abso_emu();
+            ldy_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xAD: // lda abso
+            abso_emu();
+            lda_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xAE: // ldx abso
+            abso_emu();
+            ldx_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xAF: // bbs2 zprel
+            zprel_emu();
+            bbs2_emu();
+            clockticks6502 += 5;
+            break;
+        case 0xB0: // bcs rel
+            rel_emu();
+            bcs_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xB1: // lda indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            lda_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xB2: // lda ind0
+            penaltyd = 0;
+            ind0_emu();
+            lda_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xB3: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0xB4: // ldy zpx
+            penaltyd = 0;
+            zpx_emu();
+            ldy_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xB5: // lda zpx
+            penaltyd = 0;
+            zpx_emu();
+            lda_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xB6: // ldx zpy
+            penaltyd = 0;
+            zpy_emu();
+            ldx_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xB7: // smb3 zp
+            penaltyd = 0;
+            zp_emu();
+            smb3_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xB8: // clv imp
+            imp_emu();
+            clv_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xB9: // lda absy
+            penaltyaddr = 0;
+            absy_emu();
+            lda_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBA: // tsx imp
+            imp_emu();
+            tsx_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xBB: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0xBC: // ldy absx
+            penaltyaddr = 0;
+            absx_emu();
+            ldy_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBD: // lda absx
+            penaltyaddr = 0;
+            absx_emu();
+            lda_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBE: // ldx absy
+            penaltyaddr = 0;
+            absy_emu();
+            ldx_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBF: // bbs3 zprel
+            zprel_emu();
+            bbs3_emu();
+            clockticks6502 += 5;
+            break;
+        case 0xC0: // cpy immx
+            immx_emu();
+            cpy_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xC1: // cmp indx
+            penaltyd = 0;
+            indx_emu();
+            cmp_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xC2: // nop imm8
+            imm8_emu();
+            nop_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xC3: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0xC4: // cpy zp
+            penaltyd = 0;
+            zp_emu();
+            cpy_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xC5: // cmp zp
+            penaltyd = 0;
+            zp_emu();
+            cmp_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xC6: // dec zp
+            penaltyd = 0;
+            zp_emu();
+            dec_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xC7: // smb4 zp
+            penaltyd = 0;
+            zp_emu();
+            smb4_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xC8: // iny imp
+            imp_emu();
+            iny_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xC9: // cmp immm
+            immm_emu();
+            cmp_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xCA: // dex imp
+            imp_emu();
+            dex_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xCB: // wai imp
+            imp_emu();
+            wai_emu();
+            clockticks6502 += 3;
+            break;
+        case 0xCC: // cpy abso
+            abso_emu();
+            cpy_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xCD: // cmp abso
+            abso_emu();
+            cmp_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xCE: // dec abso
+            abso_emu();
+            dec_emu();
+            clockticks6502 += 6;
+            break;
+        case 0xCF: // bbs4 zprel
+            zprel_emu();
+            bbs4_emu();
+            clockticks6502 += 5;
+            break;
+        case 0xD0: // bne rel
+            rel_emu();
+            bne_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xD1: // cmp indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            cmp_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xD2: // cmp ind0
+            penaltyd = 0;
+            ind0_emu();
+            cmp_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xD3: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0xD4: // nop imm8
+            imm8_emu();
+            nop_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xD5: // cmp zpx
+            penaltyd = 0;
+            zpx_emu();
+            cmp_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xD6: // dec zpx
+            penaltyd = 0;
+            zpx_emu();
+            dec_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD7: // smb5 zp
+            penaltyd = 0;
+            zp_emu();
+            smb5_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xD8: // cld imp
+            imp_emu();
+            cld_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xD9: // cmp absy
+            penaltyaddr = 0;
+            absy_emu();
+            cmp_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xDA: // phx imp
+            imp_emu();
+            phx_emu();
+            clockticks6502 += 3;
+            break;
+        case 0xDB: // dbg imp
+            imp_emu();
+            dbg_emu();
+            clockticks6502 += 1;
+            break;
+        case 0xDC: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xDD: // cmp absx
+            penaltyaddr = 0;
+            absx_emu();
+            cmp_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xDE: // dec absx
+            absx_emu();
+            dec_emu();
+            clockticks6502 += 7;
+            break;
+        case 0xDF: // bbs5 zprel
+            zprel_emu();
+            bbs5_emu();
+            clockticks6502 += 5;
+            break;
+        case 0xE0: // cpx immx
+            immx_emu();
+            cpx_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xE1: // sbc indx
+            penaltyd = 0;
+            indx_emu();
+            sbc_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xE2: // nop imm8
+            imm8_emu();
+            nop_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xE3: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0xE4: // cpx zp
+            penaltyd = 0;
+            zp_emu();
+            cpx_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xE5: // sbc zp
+            penaltyd = 0;
+            zp_emu();
+            sbc_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xE6: // inc zp
+            penaltyd = 0;
+            zp_emu();
+            inc_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xE7: // smb6 zp
+            penaltyd = 0;
+            zp_emu();
+            smb6_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xE8: // inx imp
+            imp_emu();
+            inx_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xE9: // sbc immm
+            immm_emu();
+            sbc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xEA: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xEB: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0xEC: // cpx abso
+            abso_emu();
+            cpx_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xED: // sbc abso
+            abso_emu();
+            sbc_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xEE: // inc abso
+            abso_emu();
+            inc_emu();
+            clockticks6502 += 6;
+            break;
+        case 0xEF: // bbs6 zprel
+            zprel_emu();
+            bbs6_emu();
+            clockticks6502 += 5;
+            break;
+        case 0xF0: // beq rel
+            rel_emu();
+            beq_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xF1: // sbc indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            sbc_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xF2: // sbc ind0
+            penaltyd = 0;
+            ind0_emu();
+            sbc_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xF3: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0xF4: // nop imm8
+            imm8_emu();
+            nop_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xF5: // sbc zpx
+            penaltyd = 0;
+            zpx_emu();
+            sbc_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xF6: // inc zpx
+            penaltyd = 0;
+            zpx_emu();
+            inc_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xF7: // smb7 zp
+            penaltyd = 0;
+            zp_emu();
+            smb7_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xF8: // sed imp
+            imp_emu();
+            sed_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xF9: // sbc absy
+            penaltyaddr = 0;
+            absy_emu();
+            sbc_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xFA: // plx imp
+            imp_emu();
+            plx_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xFB: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 1;
+            break;
+        case 0xFC: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xFD: // sbc absx
+            penaltyaddr = 0;
+            absx_emu();
+            sbc_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xFE: // inc absx
+            absx_emu();
+            inc_emu();
+            clockticks6502 += 7;
+            break;
+        case 0xFF: // bbs7 zprel
+            zprel_emu();
+            bbs7_emu();
+            clockticks6502 += 5;
+            break;
+    }
+}
+
+static const uint8_t oplength_c02[256] = {
+    /* 0 */ 0x81, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x83,
+    /* 1 */ 0x82, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x83,
+    /* 2 */ 0x83, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x81, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x83,
+    /* 3 */ 0x82, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x83,
+    /* 4 */ 0x81, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x83, 0x03, 0x03, 0x83,
+    /* 5 */ 0x82, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x83,
+    /* 6 */ 0x81, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x83, 0x03, 0x03, 0x83,
+    /* 7 */ 0x82, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x83, 0x03, 0x03, 0x83,
+    /* 8 */ 0x82, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x83,
+    /* 9 */ 0x82, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x83,
+    /* A */ 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x83,
+    /* B */ 0x82, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x83,
+    /* C */ 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x81, 0x03, 0x03, 0x03, 0x83,
+    /* D */ 0x82, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x01, 0x03, 0x03, 0x83,
+    /* E */ 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x83,
+    /* F */ 0x82, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x83
 };
 
-static void (*addrtable_c816[256])() = {
-/*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
-/* 0 */    imp8, indx, imp8,   sr,   zp,   zp,   zp,indl0,  imp, immm,  acc,  imp, abso, abso, abso, absl, /* 0 */
-/* 1 */     rel, indy, ind0,sridy,   zp,  zpx,  zpx,indly,  imp, absy,  acc,  imp, abso, absx, absx,abslx, /* 1 */
-/* 2 */    abso, indx, absl,   sr,   zp,   zp,   zp,indl0,  imp, immm,  acc,  imp, abso, abso, abso, absl, /* 2 */
-/* 3 */     rel, indy, ind0,sridy,  zpx,  zpx,  zpx,indly,  imp, absy,  acc,  imp, absx, absx, absx,abslx, /* 3 */
-/* 4 */     imp, indx, imm8,   sr,  bmv,   zp,   zp,indl0,  imp, immm,  acc,  imp, abso, abso, abso, absl, /* 4 */
-/* 5 */     rel, indy, ind0,sridy,  bmv,  zpx,  zpx,indly,  imp, absy,  imp,  imp, absl, absx, absx,abslx, /* 5 */
-/* 6 */     imp, indx,rel16,   sr,   zp,   zp,   zp,indl0,  imp, immm,  acc,  imp,  ind, abso, abso, absl, /* 6 */
-/* 7 */     rel, indy, ind0,sridy,  zpx,  zpx,  zpx,indly,  imp, absy,  imp,  imp, ainx, absx, absx,abslx, /* 7 */
-/* 8 */     rel, indx,rel16,   sr,   zp,   zp,   zp,indl0,  imp, immm,  imp,  imp, abso, abso, abso, absl, /* 8 */
-/* 9 */     rel, indy, ind0,sridy,  zpx,  zpx,  zpy,indly,  imp, absy,  imp,  imp, abso, absx, absx,abslx, /* 9 */
-/* A */    immx, indx, immx,   sr,   zp,   zp,   zp,indl0,  imp, immm,  imp,  imp, abso, abso, abso, absl, /* A */
-/* B */     rel, indy, ind0,sridy,  zpx,  zpx,  zpy,indly,  imp, absy,  imp,  imp, absx, absx, absy,abslx, /* B */
-/* C */    immx, indx, imm8,   sr,   zp,   zp,   zp,indl0,  imp, immm,  imp,  imp, abso, abso, abso, absl, /* C */
-/* D */     rel, indy, ind0,sridy,ind0p,  zpx,  zpx,indly,  imp, absy,  imp,  imp,aindl, absx, absx,abslx, /* D */
-/* E */    immx, indx, imm8,   sr,   zp,   zp,   zp,indl0,  imp, immm,  imp,  imp, abso, abso, abso, absl, /* E */
-/* F */     rel, indy, ind0,sridy,imm16,  zpx,  zpx,indly,  imp, absy,  imp,  imp, ainx, absx, absx,abslx  /* F */
+static void interpret_c816_emu() {
+    switch (opcode) {
+        case 0x00: // brk imp8
+            imp8_emu();
+            brk_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x01: // ora indx
+            penaltyd = 0;
+            indx_emu();
+            ora_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x02: // cop imp8
+            imp8_emu();
+            cop_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x03: // ora sr
+            sr_emu();
+            ora_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x04: // tsb zp
+            penaltyd = 0;
+            zp_emu();
+            tsb_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x05: // ora zp
+            penaltyd = 0;
+            zp_emu();
+            ora_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x06: // asl zp
+            penaltyd = 0;
+            zp_emu();
+            asl_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x07: // ora indl0
+            penaltyd = 0;
+            indl0_emu();
+            ora_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x08: // php imp
+            imp_emu();
+            php_emu();
+            clockticks6502 += 3;
+            break;
+        case 0x09: // ora immm
+            immm_emu();
+            ora_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x0A: // asl acc
+            acc_emu();
+            asl_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x0B: // phd imp
+            imp_emu();
+            phd_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x0C: // tsb abso
+            abso_emu();
+            tsb_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x0D: // ora abso
+            abso_emu();
+            ora_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x0E: // asl abso
+            abso_emu();
+            asl_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x0F: // ora absl
+            absl_emu();
+            ora_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x10: // bpl rel
+            rel_emu();
+            bpl_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x11: // ora indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            ora_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x12: // ora ind0
+            penaltyd = 0;
+            ind0_emu();
+            ora_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x13: // ora sridy
+            penaltyaddr = 0;
+            sridy_emu();
+            ora_emu();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x14: // trb zp
+            penaltyd = 0;
+            zp_emu();
+            trb_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x15: // ora zpx
+            penaltyd = 0;
+            zpx_emu();
+            ora_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x16: // asl zpx
+            penaltyd = 0;
+            zpx_emu();
+            asl_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x17: // ora indly
+            penaltyd = 0;
+            indly_emu();
+            ora_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x18: // clc imp
+            imp_emu();
+            clc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x19: // ora absy
+            penaltyaddr = 0;
+            absy_emu();
+            ora_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x1A: // inc acc
+            acc_emu();
+            inc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x1B: // tcs imp
+            imp_emu();
+            tcs_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x1C: // trb abso
+            abso_emu();
+            trb_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x1D: // ora absx
+            penaltyaddr = 0;
+            absx_emu();
+            ora_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x1E: // asl absx
+            absx_emu();
+            asl_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x1F: // ora abslx
+            penaltyaddr = 0;
+            abslx_emu();
+            ora_emu();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x20: // jsr abso
+            abso_emu();
+            jsr_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x21: // and indx
+            penaltyd = 0;
+            indx_emu();
+            and_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x22: // jsl absl
+            absl_emu();
+            jsl_emu();
+            clockticks6502 += 8;
+            break;
+        case 0x23: // and sr
+            sr_emu();
+            and_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x24: // bit zp
+            penaltyd = 0;
+            zp_emu();
+            bit_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x25: // and zp
+            penaltyd = 0;
+            zp_emu();
+            and_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x26: // rol zp
+            penaltyd = 0;
+            zp_emu();
+            rol_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x27: // and indl0
+            penaltyd = 0;
+            indl0_emu();
+            and_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x28: // plp imp
+            imp_emu();
+            plp_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x29: // and immm
+            immm_emu();
+            and_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x2A: // rol acc
+            acc_emu();
+            rol_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x2B: // pld imp
+            imp_emu();
+            pld_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x2C: // bit abso
+            abso_emu();
+            bit_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x2D: // and abso
+            abso_emu();
+            and_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x2E: // rol abso
+            abso_emu();
+            rol_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x2F: // and absl
+            absl_emu();
+            and_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x30: // bmi rel
+            rel_emu();
+            bmi_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x31: // and indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            and_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x32: // and ind0
+            penaltyd = 0;
+            ind0_emu();
+            and_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x33: // and sridy
+            penaltyaddr = 0;
+            sridy_emu();
+            and_emu();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x34: // bit zpx
+            penaltyd = 0;
+            zpx_emu();
+            bit_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x35: // and zpx
+            penaltyd = 0;
+            zpx_emu();
+            and_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x36: // rol zpx
+            penaltyd = 0;
+            zpx_emu();
+            rol_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x37: // and indly
+            penaltyd = 0;
+            indly_emu();
+            and_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x38: // sec imp
+            imp_emu();
+            sec_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x39: // and absy
+            penaltyaddr = 0;
+            absy_emu();
+            and_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x3A: // dec acc
+            acc_emu();
+            dec_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x3B: // tsc imp
+            imp_emu();
+            tsc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x3C: // bit absx
+            absx_emu();
+            bit_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x3D: // and absx
+            penaltyaddr = 0;
+            absx_emu();
+            and_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x3E: // rol absx
+            absx_emu();
+            rol_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x3F: // and abslx
+            penaltyaddr = 0;
+            abslx_emu();
+            and_emu();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x40: // rti imp
+            imp_emu();
+            rti_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x41: // eor indx
+            penaltyd = 0;
+            indx_emu();
+            eor_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x42: // wdm imm8
+            imm8_emu();
+            wdm_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x43: // eor sr
+            sr_emu();
+            eor_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x44: // mvp bmv
+            bmv_emu();
+            mvp_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x45: // eor zp
+            penaltyd = 0;
+            zp_emu();
+            eor_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x46: // lsr zp
+            penaltyd = 0;
+            zp_emu();
+            lsr_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x47: // eor indl0
+            penaltyd = 0;
+            indl0_emu();
+            eor_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x48: // pha imp
+            imp_emu();
+            pha_emu();
+            clockticks6502 += 3;
+            break;
+        case 0x49: // eor immm
+            immm_emu();
+            eor_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x4A: // lsr acc
+            acc_emu();
+            lsr_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x4B: // phk imp
+            imp_emu();
+            phk_emu();
+            clockticks6502 += 3;
+            break;
+        case 0x4C: // jmp abso
+            abso_emu();
+            jmp_emu();
+            clockticks6502 += 3;
+            break;
+        case 0x4D: // eor abso
+            abso_emu();
+            eor_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x4E: // lsr abso
+            abso_emu();
+            lsr_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x4F: // eor absl
+            absl_emu();
+            eor_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x50: // bvc rel
+            rel_emu();
+            bvc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x51: // eor indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            eor_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x52: // eor ind0
+            penaltyd = 0;
+            ind0_emu();
+            eor_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x53: // eor sridy
+            penaltyaddr = 0;
+            sridy_emu();
+            eor_emu();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x54: // mvn bmv
+            bmv_emu();
+            mvn_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x55: // eor zpx
+            penaltyd = 0;
+            zpx_emu();
+            eor_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x56: // lsr zpx
+            penaltyd = 0;
+            zpx_emu();
+            lsr_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x57: // eor indly
+            penaltyd = 0;
+            indly_emu();
+            eor_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x58: // cli imp
+            imp_emu();
+            cli_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x59: // eor absy
+            penaltyaddr = 0;
+            absy_emu();
+            eor_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x5A: // phy imp
+            imp_emu();
+            phy_emu();
+            clockticks6502 += 3;
+            break;
+        case 0x5B: // tcd imp
+            imp_emu();
+            tcd_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x5C: // jml absl
+            absl_emu();
+            jml_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x5D: // eor absx
+            penaltyaddr = 0;
+            absx_emu();
+            eor_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x5E: // lsr absx
+            absx_emu();
+            lsr_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x5F: // eor abslx
+            penaltyaddr = 0;
+            abslx_emu();
+            eor_emu();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x60: // rts imp
+            imp_emu();
+            rts_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x61: // adc indx
+            penaltyd = 0;
+            indx_emu();
+            adc_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x62: // per rel16
+            rel16_emu();
+            per_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x63: // adc sr
+            sr_emu();
+            adc_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x64: // stz zp
+            penaltyd = 0;
+            zp_emu();
+            stz_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x65: // adc zp
+            penaltyd = 0;
+            zp_emu();
+            adc_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x66: // ror zp
+            penaltyd = 0;
+            zp_emu();
+            ror_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x67: // adc indl0
+            penaltyd = 0;
+            indl0_emu();
+            adc_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x68: // pla imp
+            imp_emu();
+            pla_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x69: // adc immm
+            immm_emu();
+            adc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x6A: // ror acc
+            acc_emu();
+            ror_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x6B: // rtl imp
+            imp_emu();
+            rtl_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x6C: // jmp ind
+            ind_emu();
+            jmp_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x6D: // adc abso
+            abso_emu();
+            adc_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x6E: // ror abso
+            abso_emu();
+            ror_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x6F: // adc absl
+            absl_emu();
+            adc_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x70: // bvs rel
+            rel_emu();
+            bvs_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x71: // adc indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            adc_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x72: // adc ind0
+            penaltyd = 0;
+            ind0_emu();
+            adc_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x73: // adc sridy
+            penaltyaddr = 0;
+            sridy_emu();
+            adc_emu();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x74: // stz zpx
+            penaltyd = 0;
+            zpx_emu();
+            stz_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x75: // adc zpx
+            penaltyd = 0;
+            zpx_emu();
+            adc_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x76: // ror zpx
+            penaltyd = 0;
+            zpx_emu();
+            ror_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x77: // adc indly
+            penaltyd = 0;
+            indly_emu();
+            adc_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x78: // sei imp
+            imp_emu();
+            sei_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x79: // adc absy
+            penaltyaddr = 0;
+            absy_emu();
+            adc_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x7A: // ply imp
+            imp_emu();
+            ply_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x7B: // tdc imp
+            imp_emu();
+            tdc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x7C: // jmp ainx
+            ainx_emu();
+            jmp_emu();
+            clockticks6502 += 6;
+            break;
+        case 0x7D: // adc absx
+            penaltyaddr = 0;
+            absx_emu();
+            adc_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x7E: // ror absx
+            absx_emu();
+            ror_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x7F: // adc abslx
+            penaltyaddr = 0;
+            abslx_emu();
+            adc_emu();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x80: // bra rel
+            rel_emu();
+            bra_emu();
+            clockticks6502 += 3;
+            break;
+        case 0x81: // sta indx
+            penaltyd = 0;
+            indx_emu();
+            sta_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x82: // brl rel16
+            rel16_emu();
+            brl_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x83: // sta sr
+            sr_emu();
+            sta_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x84: // sty zp
+            penaltyd = 0;
+            zp_emu();
+            sty_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x85: // sta zp
+            penaltyd = 0;
+            zp_emu();
+            sta_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x86: // stx zp
+            penaltyd = 0;
+            zp_emu();
+            stx_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x87: // sta indl0
+            penaltyd = 0;
+            indl0_emu();
+            sta_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x88: // dey imp
+            imp_emu();
+            dey_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x89: // bit immm
+            immm_emu();
+            bit_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x8A: // txa imp
+            imp_emu();
+            txa_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x8B: // phb imp
+            imp_emu();
+            phb_emu();
+            clockticks6502 += 3;
+            break;
+        case 0x8C: // sty abso
+            abso_emu();
+            sty_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x8D: // sta abso
+            abso_emu();
+            sta_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x8E: // stx abso
+            abso_emu();
+            stx_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x8F: // sta absl
+            absl_emu();
+            sta_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x90: // bcc rel
+            rel_emu();
+            bcc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x91: // sta indy
+            penaltyd = 0;
+            indy_emu();
+            sta_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x92: // sta ind0
+            penaltyd = 0;
+            ind0_emu();
+            sta_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x93: // sta sridy
+            sridy_emu();
+            sta_emu();
+            clockticks6502 += 7;
+            break;
+        case 0x94: // sty zpx
+            penaltyd = 0;
+            zpx_emu();
+            sty_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x95: // sta zpx
+            penaltyd = 0;
+            zpx_emu();
+            sta_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x96: // stx zpy
+            penaltyd = 0;
+            zpy_emu();
+            stx_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x97: // sta indly
+            penaltyd = 0;
+            indly_emu();
+            sta_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x98: // tya imp
+            imp_emu();
+            tya_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x99: // sta absy
+            absy_emu();
+            sta_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x9A: // txs imp
+            imp_emu();
+            txs_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x9B: // txy imp
+            imp_emu();
+            txy_emu();
+            clockticks6502 += 2;
+            break;
+        case 0x9C: // stz abso
+            abso_emu();
+            stz_emu();
+            clockticks6502 += 4;
+            break;
+        case 0x9D: // sta absx
+            absx_emu();
+            sta_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x9E: // stz absx
+            absx_emu();
+            stz_emu();
+            clockticks6502 += 5;
+            break;
+        case 0x9F: // sta abslx
+            abslx_emu();
+            sta_emu();
+            clockticks6502 += 5;
+            break;
+        case 0xA0: // ldy immx
+            immx_emu();
+            ldy_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xA1: // lda indx
+            penaltyd = 0;
+            indx_emu();
+            lda_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xA2: // ldx immx
+            immx_emu();
+            ldx_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xA3: // lda sr
+            sr_emu();
+            lda_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xA4: // ldy zp
+            penaltyd = 0;
+            zp_emu();
+            ldy_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xA5: // lda zp
+            penaltyd = 0;
+            zp_emu();
+            lda_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xA6: // ldx zp
+            penaltyd = 0;
+            zp_emu();
+            ldx_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xA7: // lda indl0
+            penaltyd = 0;
+            indl0_emu();
+            lda_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xA8: // tay imp
+            imp_emu();
+            tay_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xA9: // lda immm
+            immm_emu();
+            lda_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xAA: // tax imp
+            imp_emu();
+            tax_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xAB: // plb imp
+            imp_emu();
+            plb_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xAC: // ldy abso
+            abso_emu();
+            ldy_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xAD: // lda abso
+            abso_emu();
+            lda_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xAE: // ldx abso
+            abso_emu();
+            ldx_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xAF: // lda absl
+            absl_emu();
+            lda_emu();
+            clockticks6502 += 5;
+            break;
+        case 0xB0: // bcs rel
+            rel_emu();
+            bcs_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xB1: // lda indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            lda_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xB2: // lda ind0
+            penaltyd = 0;
+            ind0_emu();
+            lda_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xB3: // lda sridy
+            penaltyaddr = 0;
+            sridy_emu();
+            lda_emu();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0xB4: // ldy zpx
+            penaltyd = 0;
+            zpx_emu();
+            ldy_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xB5: // lda zpx
+            penaltyd = 0;
+            zpx_emu();
+            lda_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xB6: // ldx zpy
+            penaltyd = 0;
+            zpy_emu();
+            ldx_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xB7: // lda indly
+            penaltyd = 0;
+            indly_emu();
+            lda_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xB8: // clv imp
+            imp_emu();
+            clv_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xB9: // lda absy
+            penaltyaddr = 0;
+            absy_emu();
+            lda_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBA: // tsx imp
+            imp_emu();
+            tsx_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xBB: // tyx imp
+            imp_emu();
+            tyx_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xBC: // ldy absx
+            penaltyaddr = 0;
+            absx_emu();
+            ldy_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBD: // lda absx
+            penaltyaddr = 0;
+            absx_emu();
+            lda_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBE: // ldx absy
+            penaltyaddr = 0;
+            absy_emu();
+            ldx_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBF: // lda abslx
+            penaltyaddr = 0;
+            abslx_emu();
+            lda_emu();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xC0: // cpy immx
+            immx_emu();
+            cpy_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xC1: // cmp indx
+            penaltyd = 0;
+            indx_emu();
+            cmp_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xC2: // rep imm8
+            imm8_emu();
+            rep_emu();
+            clockticks6502 += 3;
+            break;
+        case 0xC3: // cmp sr
+            sr_emu();
+            cmp_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xC4: // cpy zp
+            penaltyd = 0;
+            zp_emu();
+            cpy_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xC5: // cmp zp
+            penaltyd = 0;
+            zp_emu();
+            cmp_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xC6: // dec zp
+            penaltyd = 0;
+            zp_emu();
+            dec_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xC7: // cmp indl0
+            penaltyd = 0;
+            indl0_emu();
+            cmp_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xC8: // iny imp
+            imp_emu();
+            iny_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xC9: // cmp immm
+            immm_emu();
+            cmp_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xCA: // dex imp
+            imp_emu();
+            dex_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xCB: // wai imp
+            imp_emu();
+            wai_emu();
+            clockticks6502 += 3;
+            break;
+        case 0xCC: // cpy abso
+            abso_emu();
+            cpy_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xCD: // cmp abso
+            abso_emu();
+            cmp_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xCE: // dec abso
+            abso_emu();
+            dec_emu();
+            clockticks6502 += 6;
+            break;
+        case 0xCF: // cmp absl
+            absl_emu();
+            cmp_emu();
+            clockticks6502 += 5;
+            break;
+        case 0xD0: // bne rel
+            rel_emu();
+            bne_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xD1: // cmp indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            cmp_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xD2: // cmp ind0
+            penaltyd = 0;
+            ind0_emu();
+            cmp_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xD3: // cmp sridy
+            penaltyaddr = 0;
+            sridy_emu();
+            cmp_emu();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0xD4: // pei ind0p
+            penaltyd = 0;
+            ind0p_emu();
+            pei_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD5: // cmp zpx
+            penaltyd = 0;
+            zpx_emu();
+            cmp_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xD6: // dec zpx
+            penaltyd = 0;
+            zpx_emu();
+            dec_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD7: // cmp indly
+            penaltyd = 0;
+            indly_emu();
+            cmp_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD8: // cld imp
+            imp_emu();
+            cld_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xD9: // cmp absy
+            penaltyaddr = 0;
+            absy_emu();
+            cmp_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xDA: // phx imp
+            imp_emu();
+            phx_emu();
+            clockticks6502 += 3;
+            break;
+        case 0xDB: // dbg imp
+            imp_emu();
+            dbg_emu();
+            clockticks6502 += 1;
+            break;
+        case 0xDC: // jml aindl
+            aindl_emu();
+            jml_emu();
+            clockticks6502 += 6;
+            break;
+        case 0xDD: // cmp absx
+            penaltyaddr = 0;
+            absx_emu();
+            cmp_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xDE: // dec absx
+            absx_emu();
+            dec_emu();
+            clockticks6502 += 7;
+            break;
+        case 0xDF: // cmp abslx
+            penaltyaddr = 0;
+            abslx_emu();
+            cmp_emu();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xE0: // cpx immx
+            immx_emu();
+            cpx_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xE1: // sbc indx
+            penaltyd = 0;
+            indx_emu();
+            sbc_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xE2: // sep imm8
+            imm8_emu();
+            sep_emu();
+            clockticks6502 += 3;
+            break;
+        case 0xE3: // sbc sr
+            sr_emu();
+            sbc_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xE4: // cpx zp
+            penaltyd = 0;
+            zp_emu();
+            cpx_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xE5: // sbc zp
+            penaltyd = 0;
+            zp_emu();
+            sbc_emu();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xE6: // inc zp
+            penaltyd = 0;
+            zp_emu();
+            inc_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xE7: // sbc indl0
+            penaltyd = 0;
+            indl0_emu();
+            sbc_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xE8: // inx imp
+            imp_emu();
+            inx_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xE9: // sbc immm
+            immm_emu();
+            sbc_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xEA: // nop imp
+            imp_emu();
+            nop_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xEB: // xba imp
+            imp_emu();
+            xba_emu();
+            clockticks6502 += 3;
+            break;
+        case 0xEC: // cpx abso
+            abso_emu();
+            cpx_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xED: // sbc abso
+            abso_emu();
+            sbc_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xEE: // inc abso
+            abso_emu();
+            inc_emu();
+            clockticks6502 += 6;
+            break;
+        case 0xEF: // sbc absl
+            absl_emu();
+            sbc_emu();
+            clockticks6502 += 5;
+            break;
+        case 0xF0: // beq rel
+            rel_emu();
+            beq_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xF1: // sbc indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_emu();
+            sbc_emu();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xF2: // sbc ind0
+            penaltyd = 0;
+            ind0_emu();
+            sbc_emu();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xF3: // sbc sridy
+            penaltyaddr = 0;
+            sridy_emu();
+            sbc_emu();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0xF4: // pea imm16
+            imm16_emu();
+            pea_emu();
+            clockticks6502 += 5;
+            break;
+        case 0xF5: // sbc zpx
+            penaltyd = 0;
+            zpx_emu();
+            sbc_emu();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xF6: // inc zpx
+            penaltyd = 0;
+            zpx_emu();
+            inc_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xF7: // sbc indly
+            penaltyd = 0;
+            indly_emu();
+            sbc_emu();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xF8: // sed imp
+            imp_emu();
+            sed_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xF9: // sbc absy
+            penaltyaddr = 0;
+            absy_emu();
+            sbc_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xFA: // plx imp
+            imp_emu();
+            plx_emu();
+            clockticks6502 += 4;
+            break;
+        case 0xFB: // xce imp
+            imp_emu();
+            xce_emu();
+            clockticks6502 += 2;
+            break;
+        case 0xFC: // jsr ainx
+            ainx_emu();
+            jsr_emu();
+            clockticks6502 += 8;
+            break;
+        case 0xFD: // sbc absx
+            penaltyaddr = 0;
+            absx_emu();
+            sbc_emu();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xFE: // inc absx
+            absx_emu();
+            inc_emu();
+            clockticks6502 += 7;
+            break;
+        case 0xFF: // sbc abslx
+            penaltyaddr = 0;
+            abslx_emu();
+            sbc_emu();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+    }
+}
+
+static const uint8_t oplength_c816_emu[256] = {
+    /* 0 */ 0x81, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 1 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 2 */ 0x83, 0x02, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02, 0x81, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 3 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 4 */ 0x81, 0x02, 0x02, 0x02, 0x83, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x83, 0x03, 0x03, 0x04,
+    /* 5 */ 0x82, 0x02, 0x02, 0x02, 0x83, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x84, 0x03, 0x03, 0x04,
+    /* 6 */ 0x81, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04,
+    /* 7 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x83, 0x03, 0x03, 0x04,
+    /* 8 */ 0x82, 0x02, 0x83, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 9 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* A */ 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* B */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* C */ 0x02, 0x02, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x81, 0x03, 0x03, 0x03, 0x04,
+    /* D */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04,
+    /* E */ 0x02, 0x02, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* F */ 0x82, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04
 };
 
-static void (*optable_c02[256])() = {
-/*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
-/* 0 */      brk,  ora,  nop,  nop,  tsb,  ora,  asl, rmb0,  php,  ora,  asl,  nop,  tsb,  ora,  asl, bbr0, /* 0 */
-/* 1 */      bpl,  ora,  ora,  nop,  trb,  ora,  asl, rmb1,  clc,  ora,  inc,  nop,  trb,  ora,  asl, bbr1, /* 1 */
-/* 2 */      jsr,  and,  nop,  nop,  bit,  and,  rol, rmb2,  plp,  and,  rol,  nop,  bit,  and,  rol, bbr2, /* 2 */
-/* 3 */      bmi,  and,  and,  nop,  bit,  and,  rol, rmb3,  sec,  and,  dec,  nop,  bit,  and,  rol, bbr3, /* 3 */
-/* 4 */      rti,  eor,  nop,  nop,  nop,  eor,  lsr, rmb4,  pha,  eor,  lsr,  nop,  jmp,  eor,  lsr, bbr4, /* 4 */
-/* 5 */      bvc,  eor,  eor,  nop,  nop,  eor,  lsr, rmb5,  cli,  eor,  phy,  nop,  nop,  eor,  lsr, bbr5, /* 5 */
-/* 6 */      rts,  adc,  nop,  nop,  stz,  adc,  ror, rmb6,  pla,  adc,  ror,  nop,  jmp,  adc,  ror, bbr6, /* 6 */
-/* 7 */      bvs,  adc,  adc,  nop,  stz,  adc,  ror, rmb7,  sei,  adc,  ply,  nop,  jmp,  adc,  ror, bbr7, /* 7 */
-/* 8 */      bra,  sta,  nop,  nop,  sty,  sta,  stx, smb0,  dey,  bit,  txa,  nop,  sty,  sta,  stx, bbs0, /* 8 */
-/* 9 */      bcc,  sta,  sta,  nop,  sty,  sta,  stx, smb1,  tya,  sta,  txs,  nop,  stz,  sta,  stz, bbs1, /* 9 */
-/* A */      ldy,  lda,  ldx,  nop,  ldy,  lda,  ldx, smb2,  tay,  lda,  tax,  nop,  ldy,  lda,  ldx, bbs2, /* A */
-/* B */      bcs,  lda,  lda,  nop,  ldy,  lda,  ldx, smb3,  clv,  lda,  tsx,  nop,  ldy,  lda,  ldx, bbs3, /* B */
-/* C */      cpy,  cmp,  nop,  nop,  cpy,  cmp,  dec, smb4,  iny,  cmp,  dex,  wai,  cpy,  cmp,  dec, bbs4, /* C */
-/* D */      bne,  cmp,  cmp,  nop,  nop,  cmp,  dec, smb5,  cld,  cmp,  phx,  dbg,  nop,  cmp,  dec, bbs5, /* D */
-/* E */      cpx,  sbc,  nop,  nop,  cpx,  sbc,  inc, smb6,  inx,  sbc,  nop,  nop,  cpx,  sbc,  inc, bbs6, /* E */
-/* F */      beq,  sbc,  sbc,  nop,  nop,  sbc,  inc, smb7,  sed,  sbc,  plx,  nop,  nop,  sbc,  inc, bbs7  /* F */
+static void interpret_c816_m16x16() {
+    switch (opcode) {
+        case 0x00: // brk imp8
+            imp8_m16x16();
+            brk_m16x16();
+            clockticks6502 += 8;
+            break;
+        case 0x01: // ora indx
+            penaltyd = 0;
+            indx_m16x16();
+            ora_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x02: // cop imp8
+            imp8_m16x16();
+            cop_m16x16();
+            clockticks6502 += 8;
+            break;
+        case 0x03: // ora sr
+            sr_m16x16();
+            ora_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x04: // tsb zp
+            penaltyd = 0;
+            zp_m16x16();
+            tsb_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x05: // ora zp
+            penaltyd = 0;
+            zp_m16x16();
+            ora_m16x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x06: // asl zp
+            penaltyd = 0;
+            zp_m16x16();
+            asl_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x07: // ora indl0
+            penaltyd = 0;
+            indl0_m16x16();
+            ora_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x08: // php imp
+            imp_m16x16();
+            php_m16x16();
+            clockticks6502 += 3;
+            break;
+        case 0x09: // ora immm
+            immm_m16x16();
+            ora_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x0A: // asl acc
+            acc_m16x16();
+            asl_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x0B: // phd imp
+            imp_m16x16();
+            phd_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x0C: // tsb abso
+            abso_m16x16();
+            tsb_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0x0D: // ora abso
+            abso_m16x16();
+            ora_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x0E: // asl abso
+            abso_m16x16();
+            asl_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0x0F: // ora absl
+            absl_m16x16();
+            ora_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0x10: // bpl rel
+            rel_m16x16();
+            bpl_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x11: // ora indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x16();
+            ora_m16x16();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x12: // ora ind0
+            penaltyd = 0;
+            ind0_m16x16();
+            ora_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x13: // ora sridy
+            penaltyaddr = 0;
+            sridy_m16x16();
+            ora_m16x16();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x14: // trb zp
+            penaltyd = 0;
+            zp_m16x16();
+            trb_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x15: // ora zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            ora_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x16: // asl zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            asl_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x17: // ora indly
+            penaltyd = 0;
+            indly_m16x16();
+            ora_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x18: // clc imp
+            imp_m16x16();
+            clc_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x19: // ora absy
+            penaltyaddr = 0;
+            absy_m16x16();
+            ora_m16x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x1A: // inc acc
+            acc_m16x16();
+            inc_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x1B: // tcs imp
+            imp_m16x16();
+            tcs_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x1C: // trb abso
+            abso_m16x16();
+            trb_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0x1D: // ora absx
+            penaltyaddr = 0;
+            absx_m16x16();
+            ora_m16x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x1E: // asl absx
+            absx_m16x16();
+            asl_m16x16();
+            clockticks6502 += 7;
+            break;
+        case 0x1F: // ora abslx
+            penaltyaddr = 0;
+            abslx_m16x16();
+            ora_m16x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x20: // jsr abso
+            abso_m16x16();
+            jsr_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0x21: // and indx
+            penaltyd = 0;
+            indx_m16x16();
+            and_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x22: // jsl absl
+            absl_m16x16();
+            jsl_m16x16();
+            clockticks6502 += 8;
+            break;
+        case 0x23: // and sr
+            sr_m16x16();
+            and_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x24: // bit zp
+            penaltyd = 0;
+            zp_m16x16();
+            bit_m16x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x25: // and zp
+            penaltyd = 0;
+            zp_m16x16();
+            and_m16x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x26: // rol zp
+            penaltyd = 0;
+            zp_m16x16();
+            rol_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x27: // and indl0
+            penaltyd = 0;
+            indl0_m16x16();
+            and_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x28: // plp imp
+            imp_m16x16();
+            plp_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x29: // and immm
+            immm_m16x16();
+            and_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x2A: // rol acc
+            acc_m16x16();
+            rol_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x2B: // pld imp
+            imp_m16x16();
+            pld_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0x2C: // bit abso
+            abso_m16x16();
+            bit_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x2D: // and abso
+            abso_m16x16();
+            and_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x2E: // rol abso
+            abso_m16x16();
+            rol_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0x2F: // and absl
+            absl_m16x16();
+            and_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0x30: // bmi rel
+            rel_m16x16();
+            bmi_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x31: // and indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x16();
+            and_m16x16();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x32: // and ind0
+            penaltyd = 0;
+            ind0_m16x16();
+            and_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x33: // and sridy
+            penaltyaddr = 0;
+            sridy_m16x16();
+            and_m16x16();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x34: // bit zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            bit_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x35: // and zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            and_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x36: // rol zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            rol_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x37: // and indly
+            penaltyd = 0;
+            indly_m16x16();
+            and_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x38: // sec imp
+            imp_m16x16();
+            sec_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x39: // and absy
+            penaltyaddr = 0;
+            absy_m16x16();
+            and_m16x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x3A: // dec acc
+            acc_m16x16();
+            dec_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x3B: // tsc imp
+            imp_m16x16();
+            tsc_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x3C: // bit absx
+            absx_m16x16();
+            bit_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x3D: // and absx
+            penaltyaddr = 0;
+            absx_m16x16();
+            and_m16x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x3E: // rol absx
+            absx_m16x16();
+            rol_m16x16();
+            clockticks6502 += 7;
+            break;
+        case 0x3F: // and abslx
+            penaltyaddr = 0;
+            abslx_m16x16();
+            and_m16x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x40: // rti imp
+            imp_m16x16();
+            rti_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0x41: // eor indx
+            penaltyd = 0;
+            indx_m16x16();
+            eor_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x42: // wdm imm8
+            imm8_m16x16();
+            wdm_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x43: // eor sr
+            sr_m16x16();
+            eor_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x44: // mvp bmv
+            bmv_m16x16();
+            mvp_m16x16();
+            clockticks6502 += 7;
+            break;
+        case 0x45: // eor zp
+            penaltyd = 0;
+            zp_m16x16();
+            eor_m16x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x46: // lsr zp
+            penaltyd = 0;
+            zp_m16x16();
+            lsr_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x47: // eor indl0
+            penaltyd = 0;
+            indl0_m16x16();
+            eor_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x48: // pha imp
+            imp_m16x16();
+            pha_m16x16();
+            clockticks6502 += 3;
+            break;
+        case 0x49: // eor immm
+            immm_m16x16();
+            eor_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x4A: // lsr acc
+            acc_m16x16();
+            lsr_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x4B: // phk imp
+            imp_m16x16();
+            phk_m16x16();
+            clockticks6502 += 3;
+            break;
+        case 0x4C: // jmp abso
+            abso_m16x16();
+            jmp_m16x16();
+            clockticks6502 += 3;
+            break;
+        case 0x4D: // eor abso
+            abso_m16x16();
+            eor_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x4E: // lsr abso
+            abso_m16x16();
+            lsr_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0x4F: // eor absl
+            absl_m16x16();
+            eor_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0x50: // bvc rel
+            rel_m16x16();
+            bvc_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x51: // eor indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x16();
+            eor_m16x16();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x52: // eor ind0
+            penaltyd = 0;
+            ind0_m16x16();
+            eor_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x53: // eor sridy
+            penaltyaddr = 0;
+            sridy_m16x16();
+            eor_m16x16();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x54: // mvn bmv
+            bmv_m16x16();
+            mvn_m16x16();
+            clockticks6502 += 7;
+            break;
+        case 0x55: // eor zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            eor_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x56: // lsr zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            lsr_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x57: // eor indly
+            penaltyd = 0;
+            indly_m16x16();
+            eor_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x58: // cli imp
+            imp_m16x16();
+            cli_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x59: // eor absy
+            penaltyaddr = 0;
+            absy_m16x16();
+            eor_m16x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x5A: // phy imp
+            imp_m16x16();
+            phy_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x5B: // tcd imp
+            imp_m16x16();
+            tcd_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x5C: // jml absl
+            absl_m16x16();
+            jml_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x5D: // eor absx
+            penaltyaddr = 0;
+            absx_m16x16();
+            eor_m16x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x5E: // lsr absx
+            absx_m16x16();
+            lsr_m16x16();
+            clockticks6502 += 7;
+            break;
+        case 0x5F: // eor abslx
+            penaltyaddr = 0;
+            abslx_m16x16();
+            eor_m16x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x60: // rts imp
+            imp_m16x16();
+            rts_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0x61: // adc indx
+            penaltyd = 0;
+            indx_m16x16();
+            adc_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x62: // per rel16
+            rel16_m16x16();
+            per_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0x63: // adc sr
+            sr_m16x16();
+            adc_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x64: // stz zp
+            penaltyd = 0;
+            zp_m16x16();
+            stz_m16x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x65: // adc zp
+            penaltyd = 0;
+            zp_m16x16();
+            adc_m16x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x66: // ror zp
+            penaltyd = 0;
+            zp_m16x16();
+            ror_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x67: // adc indl0
+            penaltyd = 0;
+            indl0_m16x16();
+            adc_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x68: // pla imp
+            imp_m16x16();
+            pla_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x69: // adc immm
+            immm_m16x16();
+            adc_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x6A: // ror acc
+            acc_m16x16();
+            ror_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x6B: // rtl imp
+            imp_m16x16();
+            rtl_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0x6C: // jmp ind
+            ind_m16x16();
+            jmp_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0x6D: // adc abso
+            abso_m16x16();
+            adc_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x6E: // ror abso
+            abso_m16x16();
+            ror_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0x6F: // adc absl
+            absl_m16x16();
+            adc_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0x70: // bvs rel
+            rel_m16x16();
+            bvs_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x71: // adc indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x16();
+            adc_m16x16();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x72: // adc ind0
+            penaltyd = 0;
+            ind0_m16x16();
+            adc_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x73: // adc sridy
+            penaltyaddr = 0;
+            sridy_m16x16();
+            adc_m16x16();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x74: // stz zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            stz_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x75: // adc zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            adc_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x76: // ror zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            ror_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x77: // adc indly
+            penaltyd = 0;
+            indly_m16x16();
+            adc_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x78: // sei imp
+            imp_m16x16();
+            sei_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x79: // adc absy
+            penaltyaddr = 0;
+            absy_m16x16();
+            adc_m16x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x7A: // ply imp
+            imp_m16x16();
+            ply_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0x7B: // tdc imp
+            imp_m16x16();
+            tdc_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x7C: // jmp ainx
+            ainx_m16x16();
+            jmp_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0x7D: // adc absx
+            penaltyaddr = 0;
+            absx_m16x16();
+            adc_m16x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x7E: // ror absx
+            absx_m16x16();
+            ror_m16x16();
+            clockticks6502 += 7;
+            break;
+        case 0x7F: // adc abslx
+            penaltyaddr = 0;
+            abslx_m16x16();
+            adc_m16x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x80: // bra rel
+            rel_m16x16();
+            bra_m16x16();
+            clockticks6502 += 3;
+            break;
+        case 0x81: // sta indx
+            penaltyd = 0;
+            indx_m16x16();
+            sta_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x82: // brl rel16
+            rel16_m16x16();
+            brl_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x83: // sta sr
+            sr_m16x16();
+            sta_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x84: // sty zp
+            penaltyd = 0;
+            zp_m16x16();
+            sty_m16x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x85: // sta zp
+            penaltyd = 0;
+            zp_m16x16();
+            sta_m16x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x86: // stx zp
+            penaltyd = 0;
+            zp_m16x16();
+            stx_m16x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x87: // sta indl0
+            penaltyd = 0;
+            indl0_m16x16();
+            sta_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x88: // dey imp
+            imp_m16x16();
+            dey_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x89: // bit immm
+            immm_m16x16();
+            bit_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x8A: // txa imp
+            imp_m16x16();
+            txa_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x8B: // phb imp
+            imp_m16x16();
+            phb_m16x16();
+            clockticks6502 += 3;
+            break;
+        case 0x8C: // sty abso
+            abso_m16x16();
+            sty_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x8D: // sta abso
+            abso_m16x16();
+            sta_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x8E: // stx abso
+            abso_m16x16();
+            stx_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x8F: // sta absl
+            absl_m16x16();
+            sta_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0x90: // bcc rel
+            rel_m16x16();
+            bcc_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x91: // sta indy
+            penaltyd = 0;
+            indy_m16x16();
+            sta_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x92: // sta ind0
+            penaltyd = 0;
+            ind0_m16x16();
+            sta_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x93: // sta sridy
+            sridy_m16x16();
+            sta_m16x16();
+            clockticks6502 += 7;
+            break;
+        case 0x94: // sty zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            sty_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x95: // sta zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            sta_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x96: // stx zpy
+            penaltyd = 0;
+            zpy_m16x16();
+            stx_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x97: // sta indly
+            penaltyd = 0;
+            indly_m16x16();
+            sta_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x98: // tya imp
+            imp_m16x16();
+            tya_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x99: // sta absy
+            absy_m16x16();
+            sta_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0x9A: // txs imp
+            imp_m16x16();
+            txs_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x9B: // txy imp
+            imp_m16x16();
+            txy_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0x9C: // stz abso
+            abso_m16x16();
+            stz_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0x9D: // sta absx
+            absx_m16x16();
+            sta_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0x9E: // stz absx
+            absx_m16x16();
+            stz_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0x9F: // sta abslx
+            abslx_m16x16();
+            sta_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0xA0: // ldy immx
+            immx_m16x16();
+            ldy_m16x16();
+            clockticks6502 += 3;
+            break;
+        case 0xA1: // lda indx
+            penaltyd = 0;
+            indx_m16x16();
+            lda_m16x16();
+            clockticks6502 += 7 + penaltyd;
+            break;
+        case 0xA2: // ldx immx
+            immx_m16x16();
+            ldx_m16x16();
+            clockticks6502 += 3;
+            break;
+        case 0xA3: // lda sr
+            sr_m16x16();
+            lda_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0xA4: // ldy zp
+            penaltyd = 0;
+            zp_m16x16();
+            ldy_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xA5: // lda zp
+            penaltyd = 0;
+            zp_m16x16();
+            lda_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xA6: // ldx zp
+            penaltyd = 0;
+            zp_m16x16();
+            ldx_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xA7: // lda indl0
+            penaltyd = 0;
+            indl0_m16x16();
+            lda_m16x16();
+            clockticks6502 += 7 + penaltyd;
+            break;
+        case 0xA8: // tay imp
+            imp_m16x16();
+            tay_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xA9: // lda immm
+            immm_m16x16();
+            lda_m16x16();
+            clockticks6502 += 3;
+            break;
+        case 0xAA: // tax imp
+            imp_m16x16();
+            tax_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xAB: // plb imp
+            imp_m16x16();
+            plb_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0xAC: // ldy abso
+            abso_m16x16();
+            ldy_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0xAD: // lda abso
+            abso_m16x16();
+            lda_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0xAE: // ldx abso
+            abso_m16x16();
+            ldx_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0xAF: // lda absl
+            absl_m16x16();
+            lda_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0xB0: // bcs rel
+            rel_m16x16();
+            bcs_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xB1: // lda indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x16();
+            lda_m16x16();
+            clockticks6502 += 6 + penaltyaddr + penaltyd;
+            break;
+        case 0xB2: // lda ind0
+            penaltyd = 0;
+            ind0_m16x16();
+            lda_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xB3: // lda sridy
+            penaltyaddr = 0;
+            sridy_m16x16();
+            lda_m16x16();
+            clockticks6502 += 8 + penaltyaddr;
+            break;
+        case 0xB4: // ldy zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            ldy_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xB5: // lda zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            lda_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xB6: // ldx zpy
+            penaltyd = 0;
+            zpy_m16x16();
+            ldx_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xB7: // lda indly
+            penaltyd = 0;
+            indly_m16x16();
+            lda_m16x16();
+            clockticks6502 += 7 + penaltyd;
+            break;
+        case 0xB8: // clv imp
+            imp_m16x16();
+            clv_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xB9: // lda absy
+            penaltyaddr = 0;
+            absy_m16x16();
+            lda_m16x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xBA: // tsx imp
+            imp_m16x16();
+            tsx_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xBB: // tyx imp
+            imp_m16x16();
+            tyx_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xBC: // ldy absx
+            penaltyaddr = 0;
+            absx_m16x16();
+            ldy_m16x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xBD: // lda absx
+            penaltyaddr = 0;
+            absx_m16x16();
+            lda_m16x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xBE: // ldx absy
+            penaltyaddr = 0;
+            absy_m16x16();
+            ldx_m16x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xBF: // lda abslx
+            penaltyaddr = 0;
+            abslx_m16x16();
+            lda_m16x16();
+            clockticks6502 += 6 + penaltyaddr;
+            break;
+        case 0xC0: // cpy immx
+            immx_m16x16();
+            cpy_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xC1: // cmp indx
+            penaltyd = 0;
+            indx_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xC2: // rep imm8
+            imm8_m16x16();
+            rep_m16x16();
+            clockticks6502 += 3;
+            break;
+        case 0xC3: // cmp sr
+            sr_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0xC4: // cpy zp
+            penaltyd = 0;
+            zp_m16x16();
+            cpy_m16x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xC5: // cmp zp
+            penaltyd = 0;
+            zp_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xC6: // dec zp
+            penaltyd = 0;
+            zp_m16x16();
+            dec_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xC7: // cmp indl0
+            penaltyd = 0;
+            indl0_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xC8: // iny imp
+            imp_m16x16();
+            iny_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xC9: // cmp immm
+            immm_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xCA: // dex imp
+            imp_m16x16();
+            dex_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xCB: // wai imp
+            imp_m16x16();
+            wai_m16x16();
+            clockticks6502 += 3;
+            break;
+        case 0xCC: // cpy abso
+            abso_m16x16();
+            cpy_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0xCD: // cmp abso
+            abso_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0xCE: // dec abso
+            abso_m16x16();
+            dec_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0xCF: // cmp absl
+            absl_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0xD0: // bne rel
+            rel_m16x16();
+            bne_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xD1: // cmp indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xD2: // cmp ind0
+            penaltyd = 0;
+            ind0_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xD3: // cmp sridy
+            penaltyaddr = 0;
+            sridy_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0xD4: // pei ind0p
+            penaltyd = 0;
+            ind0p_m16x16();
+            pei_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD5: // cmp zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xD6: // dec zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            dec_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD7: // cmp indly
+            penaltyd = 0;
+            indly_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD8: // cld imp
+            imp_m16x16();
+            cld_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xD9: // cmp absy
+            penaltyaddr = 0;
+            absy_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xDA: // phx imp
+            imp_m16x16();
+            phx_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0xDB: // dbg imp
+            imp_m16x16();
+            dbg_m16x16();
+            clockticks6502 += 1;
+            break;
+        case 0xDC: // jml aindl
+            aindl_m16x16();
+            jml_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0xDD: // cmp absx
+            penaltyaddr = 0;
+            absx_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xDE: // dec absx
+            absx_m16x16();
+            dec_m16x16();
+            clockticks6502 += 7;
+            break;
+        case 0xDF: // cmp abslx
+            penaltyaddr = 0;
+            abslx_m16x16();
+            cmp_m16x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xE0: // cpx immx
+            immx_m16x16();
+            cpx_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xE1: // sbc indx
+            penaltyd = 0;
+            indx_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xE2: // sep imm8
+            imm8_m16x16();
+            sep_m16x16();
+            clockticks6502 += 3;
+            break;
+        case 0xE3: // sbc sr
+            sr_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0xE4: // cpx zp
+            penaltyd = 0;
+            zp_m16x16();
+            cpx_m16x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xE5: // sbc zp
+            penaltyd = 0;
+            zp_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xE6: // inc zp
+            penaltyd = 0;
+            zp_m16x16();
+            inc_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xE7: // sbc indl0
+            penaltyd = 0;
+            indl0_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xE8: // inx imp
+            imp_m16x16();
+            inx_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xE9: // sbc immm
+            immm_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xEA: // nop imp
+            imp_m16x16();
+            nop_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xEB: // xba imp
+            imp_m16x16();
+            xba_m16x16();
+            clockticks6502 += 3;
+            break;
+        case 0xEC: // cpx abso
+            abso_m16x16();
+            cpx_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0xED: // sbc abso
+            abso_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 4;
+            break;
+        case 0xEE: // inc abso
+            abso_m16x16();
+            inc_m16x16();
+            clockticks6502 += 6;
+            break;
+        case 0xEF: // sbc absl
+            absl_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0xF0: // beq rel
+            rel_m16x16();
+            beq_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xF1: // sbc indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xF2: // sbc ind0
+            penaltyd = 0;
+            ind0_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xF3: // sbc sridy
+            penaltyaddr = 0;
+            sridy_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0xF4: // pea imm16
+            imm16_m16x16();
+            pea_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0xF5: // sbc zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xF6: // inc zpx
+            penaltyd = 0;
+            zpx_m16x16();
+            inc_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xF7: // sbc indly
+            penaltyd = 0;
+            indly_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xF8: // sed imp
+            imp_m16x16();
+            sed_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xF9: // sbc absy
+            penaltyaddr = 0;
+            absy_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xFA: // plx imp
+            imp_m16x16();
+            plx_m16x16();
+            clockticks6502 += 5;
+            break;
+        case 0xFB: // xce imp
+            imp_m16x16();
+            xce_m16x16();
+            clockticks6502 += 2;
+            break;
+        case 0xFC: // jsr ainx
+            ainx_m16x16();
+            jsr_m16x16();
+            clockticks6502 += 8;
+            break;
+        case 0xFD: // sbc absx
+            penaltyaddr = 0;
+            absx_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xFE: // inc absx
+            absx_m16x16();
+            inc_m16x16();
+            clockticks6502 += 7;
+            break;
+        case 0xFF: // sbc abslx
+            penaltyaddr = 0;
+            abslx_m16x16();
+            sbc_m16x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+    }
+}
+
+static const uint8_t oplength_c816_m16x16[256] = {
+    /* 0 */ 0x81, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 1 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 2 */ 0x83, 0x02, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02, 0x81, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 3 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 4 */ 0x81, 0x02, 0x02, 0x02, 0x83, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x83, 0x03, 0x03, 0x04,
+    /* 5 */ 0x82, 0x02, 0x02, 0x02, 0x83, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x84, 0x03, 0x03, 0x04,
+    /* 6 */ 0x81, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04,
+    /* 7 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x83, 0x03, 0x03, 0x04,
+    /* 8 */ 0x82, 0x02, 0x83, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 9 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* A */ 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* B */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* C */ 0x03, 0x02, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x03, 0x03, 0x03, 0x04,
+    /* D */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04,
+    /* E */ 0x03, 0x02, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* F */ 0x82, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04
 };
 
-static void (*optable_c816[256])() = {
-/*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
-/* 0 */      brk,  ora,  cop,  ora,  tsb,  ora,  asl,  ora,  php,  ora,  asl,  phd,  tsb,  ora,  asl,  ora, /* 0 */
-/* 1 */      bpl,  ora,  ora,  ora,  trb,  ora,  asl,  ora,  clc,  ora,  inc,  tcs,  trb,  ora,  asl,  ora, /* 1 */
-/* 2 */      jsr,  and,  jsl,  and,  bit,  and,  rol,  and,  plp,  and,  rol,  pld,  bit,  and,  rol,  and, /* 2 */
-/* 3 */      bmi,  and,  and,  and,  bit,  and,  rol,  and,  sec,  and,  dec,  tsc,  bit,  and,  rol,  and, /* 3 */
-/* 4 */      rti,  eor,  wdm,  eor,  mvp,  eor,  lsr,  eor,  pha,  eor,  lsr,  phk,  jmp,  eor,  lsr,  eor, /* 4 */
-/* 5 */      bvc,  eor,  eor,  eor,  mvn,  eor,  lsr,  eor,  cli,  eor,  phy,  tcd,  jml,  eor,  lsr,  eor, /* 5 */
-/* 6 */      rts,  adc,  per,  adc,  stz,  adc,  ror,  adc,  pla,  adc,  ror,  rtl,  jmp,  adc,  ror,  adc, /* 6 */
-/* 7 */      bvs,  adc,  adc,  adc,  stz,  adc,  ror,  adc,  sei,  adc,  ply,  tdc,  jmp,  adc,  ror,  adc, /* 7 */
-/* 8 */      bra,  sta,  brl,  sta,  sty,  sta,  stx,  sta,  dey,  bit,  txa,  phb,  sty,  sta,  stx,  sta, /* 8 */
-/* 9 */      bcc,  sta,  sta,  sta,  sty,  sta,  stx,  sta,  tya,  sta,  txs,  txy,  stz,  sta,  stz,  sta, /* 9 */
-/* A */      ldy,  lda,  ldx,  lda,  ldy,  lda,  ldx,  lda,  tay,  lda,  tax,  plb,  ldy,  lda,  ldx,  lda, /* A */
-/* B */      bcs,  lda,  lda,  lda,  ldy,  lda,  ldx,  lda,  clv,  lda,  tsx,  tyx,  ldy,  lda,  ldx,  lda, /* B */
-/* C */      cpy,  cmp,  rep,  cmp,  cpy,  cmp,  dec,  cmp,  iny,  cmp,  dex,  wai,  cpy,  cmp,  dec,  cmp, /* C */
-/* D */      bne,  cmp,  cmp,  cmp,  pei,  cmp,  dec,  cmp,  cld,  cmp,  phx,  dbg,  jml,  cmp,  dec,  cmp, /* D */
-/* E */      cpx,  sbc,  sep,  sbc,  cpx,  sbc,  inc,  sbc,  inx,  sbc,  nop,  xba,  cpx,  sbc,  inc,  sbc, /* E */
-/* F */      beq,  sbc,  sbc,  sbc,  pea,  sbc,  inc,  sbc,  sed,  sbc,  plx,  xce,  jsr,  sbc,  inc,  sbc  /* F */
+static void interpret_c816_m16x8() {
+    switch (opcode) {
+        case 0x00: // brk imp8
+            imp8_m16x8();
+            brk_m16x8();
+            clockticks6502 += 8;
+            break;
+        case 0x01: // ora indx
+            penaltyd = 0;
+            indx_m16x8();
+            ora_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x02: // cop imp8
+            imp8_m16x8();
+            cop_m16x8();
+            clockticks6502 += 8;
+            break;
+        case 0x03: // ora sr
+            sr_m16x8();
+            ora_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x04: // tsb zp
+            penaltyd = 0;
+            zp_m16x8();
+            tsb_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x05: // ora zp
+            penaltyd = 0;
+            zp_m16x8();
+            ora_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x06: // asl zp
+            penaltyd = 0;
+            zp_m16x8();
+            asl_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x07: // ora indl0
+            penaltyd = 0;
+            indl0_m16x8();
+            ora_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x08: // php imp
+            imp_m16x8();
+            php_m16x8();
+            clockticks6502 += 3;
+            break;
+        case 0x09: // ora immm
+            immm_m16x8();
+            ora_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x0A: // asl acc
+            acc_m16x8();
+            asl_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x0B: // phd imp
+            imp_m16x8();
+            phd_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x0C: // tsb abso
+            abso_m16x8();
+            tsb_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0x0D: // ora abso
+            abso_m16x8();
+            ora_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x0E: // asl abso
+            abso_m16x8();
+            asl_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0x0F: // ora absl
+            absl_m16x8();
+            ora_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0x10: // bpl rel
+            rel_m16x8();
+            bpl_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x11: // ora indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x8();
+            ora_m16x8();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x12: // ora ind0
+            penaltyd = 0;
+            ind0_m16x8();
+            ora_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x13: // ora sridy
+            penaltyaddr = 0;
+            sridy_m16x8();
+            ora_m16x8();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x14: // trb zp
+            penaltyd = 0;
+            zp_m16x8();
+            trb_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x15: // ora zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            ora_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x16: // asl zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            asl_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x17: // ora indly
+            penaltyd = 0;
+            indly_m16x8();
+            ora_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x18: // clc imp
+            imp_m16x8();
+            clc_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x19: // ora absy
+            penaltyaddr = 0;
+            absy_m16x8();
+            ora_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x1A: // inc acc
+            acc_m16x8();
+            inc_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x1B: // tcs imp
+            imp_m16x8();
+            tcs_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x1C: // trb abso
+            abso_m16x8();
+            trb_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0x1D: // ora absx
+            penaltyaddr = 0;
+            absx_m16x8();
+            ora_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x1E: // asl absx
+            absx_m16x8();
+            asl_m16x8();
+            clockticks6502 += 7;
+            break;
+        case 0x1F: // ora abslx
+            penaltyaddr = 0;
+            abslx_m16x8();
+            ora_m16x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x20: // jsr abso
+            abso_m16x8();
+            jsr_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0x21: // and indx
+            penaltyd = 0;
+            indx_m16x8();
+            and_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x22: // jsl absl
+            absl_m16x8();
+            jsl_m16x8();
+            clockticks6502 += 8;
+            break;
+        case 0x23: // and sr
+            sr_m16x8();
+            and_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x24: // bit zp
+            penaltyd = 0;
+            zp_m16x8();
+            bit_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x25: // and zp
+            penaltyd = 0;
+            zp_m16x8();
+            and_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x26: // rol zp
+            penaltyd = 0;
+            zp_m16x8();
+            rol_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x27: // and indl0
+            penaltyd = 0;
+            indl0_m16x8();
+            and_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x28: // plp imp
+            imp_m16x8();
+            plp_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x29: // and immm
+            immm_m16x8();
+            and_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x2A: // rol acc
+            acc_m16x8();
+            rol_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x2B: // pld imp
+            imp_m16x8();
+            pld_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0x2C: // bit abso
+            abso_m16x8();
+            bit_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x2D: // and abso
+            abso_m16x8();
+            and_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x2E: // rol abso
+            abso_m16x8();
+            rol_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0x2F: // and absl
+            absl_m16x8();
+            and_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0x30: // bmi rel
+            rel_m16x8();
+            bmi_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x31: // and indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x8();
+            and_m16x8();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x32: // and ind0
+            penaltyd = 0;
+            ind0_m16x8();
+            and_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x33: // and sridy
+            penaltyaddr = 0;
+            sridy_m16x8();
+            and_m16x8();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x34: // bit zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            bit_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x35: // and zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            and_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x36: // rol zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            rol_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x37: // and indly
+            penaltyd = 0;
+            indly_m16x8();
+            and_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x38: // sec imp
+            imp_m16x8();
+            sec_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x39: // and absy
+            penaltyaddr = 0;
+            absy_m16x8();
+            and_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x3A: // dec acc
+            acc_m16x8();
+            dec_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x3B: // tsc imp
+            imp_m16x8();
+            tsc_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x3C: // bit absx
+            absx_m16x8();
+            bit_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x3D: // and absx
+            penaltyaddr = 0;
+            absx_m16x8();
+            and_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x3E: // rol absx
+            absx_m16x8();
+            rol_m16x8();
+            clockticks6502 += 7;
+            break;
+        case 0x3F: // and abslx
+            penaltyaddr = 0;
+            abslx_m16x8();
+            and_m16x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x40: // rti imp
+            imp_m16x8();
+            rti_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0x41: // eor indx
+            penaltyd = 0;
+            indx_m16x8();
+            eor_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x42: // wdm imm8
+            imm8_m16x8();
+            wdm_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x43: // eor sr
+            sr_m16x8();
+            eor_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x44: // mvp bmv
+            bmv_m16x8();
+            mvp_m16x8();
+            clockticks6502 += 7;
+            break;
+        case 0x45: // eor zp
+            penaltyd = 0;
+            zp_m16x8();
+            eor_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x46: // lsr zp
+            penaltyd = 0;
+            zp_m16x8();
+            lsr_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x47: // eor indl0
+            penaltyd = 0;
+            indl0_m16x8();
+            eor_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x48: // pha imp
+            imp_m16x8();
+            pha_m16x8();
+            clockticks6502 += 3;
+            break;
+        case 0x49: // eor immm
+            immm_m16x8();
+            eor_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x4A: // lsr acc
+            acc_m16x8();
+            lsr_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x4B: // phk imp
+            imp_m16x8();
+            phk_m16x8();
+            clockticks6502 += 3;
+            break;
+        case 0x4C: // jmp abso
+            abso_m16x8();
+            jmp_m16x8();
+            clockticks6502 += 3;
+            break;
+        case 0x4D: // eor abso
+            abso_m16x8();
+            eor_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x4E: // lsr abso
+            abso_m16x8();
+            lsr_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0x4F: // eor absl
+            absl_m16x8();
+            eor_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0x50: // bvc rel
+            rel_m16x8();
+            bvc_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x51: // eor indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x8();
+            eor_m16x8();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x52: // eor ind0
+            penaltyd = 0;
+            ind0_m16x8();
+            eor_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x53: // eor sridy
+            penaltyaddr = 0;
+            sridy_m16x8();
+            eor_m16x8();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x54: // mvn bmv
+            bmv_m16x8();
+            mvn_m16x8();
+            clockticks6502 += 7;
+            break;
+        case 0x55: // eor zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            eor_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x56: // lsr zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            lsr_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x57: // eor indly
+            penaltyd = 0;
+            indly_m16x8();
+            eor_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x58: // cli imp
+            imp_m16x8();
+            cli_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x59: // eor absy
+            penaltyaddr = 0;
+            absy_m16x8();
+            eor_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x5A: // phy imp
+            imp_m16x8();
+            phy_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x5B: // tcd imp
+            imp_m16x8();
+            tcd_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x5C: // jml absl
+            absl_m16x8();
+            jml_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x5D: // eor absx
+            penaltyaddr = 0;
+            absx_m16x8();
+            eor_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x5E: // lsr absx
+            absx_m16x8();
+            lsr_m16x8();
+            clockticks6502 += 7;
+            break;
+        case 0x5F: // eor abslx
+            penaltyaddr = 0;
+            abslx_m16x8();
+            eor_m16x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x60: // rts imp
+            imp_m16x8();
+            rts_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0x61: // adc indx
+            penaltyd = 0;
+            indx_m16x8();
+            adc_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x62: // per rel16
+            rel16_m16x8();
+            per_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0x63: // adc sr
+            sr_m16x8();
+            adc_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x64: // stz zp
+            penaltyd = 0;
+            zp_m16x8();
+            stz_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x65: // adc zp
+            penaltyd = 0;
+            zp_m16x8();
+            adc_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x66: // ror zp
+            penaltyd = 0;
+            zp_m16x8();
+            ror_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x67: // adc indl0
+            penaltyd = 0;
+            indl0_m16x8();
+            adc_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x68: // pla imp
+            imp_m16x8();
+            pla_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x69: // adc immm
+            immm_m16x8();
+            adc_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x6A: // ror acc
+            acc_m16x8();
+            ror_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x6B: // rtl imp
+            imp_m16x8();
+            rtl_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0x6C: // jmp ind
+            ind_m16x8();
+            jmp_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0x6D: // adc abso
+            abso_m16x8();
+            adc_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x6E: // ror abso
+            abso_m16x8();
+            ror_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0x6F: // adc absl
+            absl_m16x8();
+            adc_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0x70: // bvs rel
+            rel_m16x8();
+            bvs_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x71: // adc indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x8();
+            adc_m16x8();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x72: // adc ind0
+            penaltyd = 0;
+            ind0_m16x8();
+            adc_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x73: // adc sridy
+            penaltyaddr = 0;
+            sridy_m16x8();
+            adc_m16x8();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x74: // stz zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            stz_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x75: // adc zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            adc_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x76: // ror zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            ror_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x77: // adc indly
+            penaltyd = 0;
+            indly_m16x8();
+            adc_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x78: // sei imp
+            imp_m16x8();
+            sei_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x79: // adc absy
+            penaltyaddr = 0;
+            absy_m16x8();
+            adc_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x7A: // ply imp
+            imp_m16x8();
+            ply_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0x7B: // tdc imp
+            imp_m16x8();
+            tdc_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x7C: // jmp ainx
+            ainx_m16x8();
+            jmp_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0x7D: // adc absx
+            penaltyaddr = 0;
+            absx_m16x8();
+            adc_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x7E: // ror absx
+            absx_m16x8();
+            ror_m16x8();
+            clockticks6502 += 7;
+            break;
+        case 0x7F: // adc abslx
+            penaltyaddr = 0;
+            abslx_m16x8();
+            adc_m16x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x80: // bra rel
+            rel_m16x8();
+            bra_m16x8();
+            clockticks6502 += 3;
+            break;
+        case 0x81: // sta indx
+            penaltyd = 0;
+            indx_m16x8();
+            sta_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x82: // brl rel16
+            rel16_m16x8();
+            brl_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x83: // sta sr
+            sr_m16x8();
+            sta_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x84: // sty zp
+            penaltyd = 0;
+            zp_m16x8();
+            sty_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x85: // sta zp
+            penaltyd = 0;
+            zp_m16x8();
+            sta_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x86: // stx zp
+            penaltyd = 0;
+            zp_m16x8();
+            stx_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x87: // sta indl0
+            penaltyd = 0;
+            indl0_m16x8();
+            sta_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x88: // dey imp
+            imp_m16x8();
+            dey_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x89: // bit immm
+            immm_m16x8();
+            bit_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x8A: // txa imp
+            imp_m16x8();
+            txa_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x8B: // phb imp
+            imp_m16x8();
+            phb_m16x8();
+            clockticks6502 += 3;
+            break;
+        case 0x8C: // sty abso
+            abso_m16x8();
+            sty_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x8D: // sta abso
+            abso_m16x8();
+            sta_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x8E: // stx abso
+            abso_m16x8();
+            stx_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x8F: // sta absl
+            absl_m16x8();
+            sta_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0x90: // bcc rel
+            rel_m16x8();
+            bcc_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x91: // sta indy
+            penaltyd = 0;
+            indy_m16x8();
+            sta_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x92: // sta ind0
+            penaltyd = 0;
+            ind0_m16x8();
+            sta_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x93: // sta sridy
+            sridy_m16x8();
+            sta_m16x8();
+            clockticks6502 += 7;
+            break;
+        case 0x94: // sty zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            sty_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x95: // sta zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            sta_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x96: // stx zpy
+            penaltyd = 0;
+            zpy_m16x8();
+            stx_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x97: // sta indly
+            penaltyd = 0;
+            indly_m16x8();
+            sta_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x98: // tya imp
+            imp_m16x8();
+            tya_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x99: // sta absy
+            absy_m16x8();
+            sta_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0x9A: // txs imp
+            imp_m16x8();
+            txs_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x9B: // txy imp
+            imp_m16x8();
+            txy_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0x9C: // stz abso
+            abso_m16x8();
+            stz_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0x9D: // sta absx
+            absx_m16x8();
+            sta_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0x9E: // stz absx
+            absx_m16x8();
+            stz_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0x9F: // sta abslx
+            abslx_m16x8();
+            sta_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0xA0: // ldy immx
+            immx_m16x8();
+            ldy_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xA1: // lda indx
+            penaltyd = 0;
+            indx_m16x8();
+            lda_m16x8();
+            clockticks6502 += 7 + penaltyd;
+            break;
+        case 0xA2: // ldx immx
+            immx_m16x8();
+            ldx_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xA3: // lda sr
+            sr_m16x8();
+            lda_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0xA4: // ldy zp
+            penaltyd = 0;
+            zp_m16x8();
+            ldy_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xA5: // lda zp
+            penaltyd = 0;
+            zp_m16x8();
+            lda_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xA6: // ldx zp
+            penaltyd = 0;
+            zp_m16x8();
+            ldx_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xA7: // lda indl0
+            penaltyd = 0;
+            indl0_m16x8();
+            lda_m16x8();
+            clockticks6502 += 7 + penaltyd;
+            break;
+        case 0xA8: // tay imp
+            imp_m16x8();
+            tay_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xA9: // lda immm
+            immm_m16x8();
+            lda_m16x8();
+            clockticks6502 += 3;
+            break;
+        case 0xAA: // tax imp
+            imp_m16x8();
+            tax_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xAB: // plb imp
+            imp_m16x8();
+            plb_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0xAC: // ldy abso
+            abso_m16x8();
+            ldy_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0xAD: // lda abso
+            abso_m16x8();
+            lda_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0xAE: // ldx abso
+            abso_m16x8();
+            ldx_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0xAF: // lda absl
+            absl_m16x8();
+            lda_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0xB0: // bcs rel
+            rel_m16x8();
+            bcs_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xB1: // lda indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x8();
+            lda_m16x8();
+            clockticks6502 += 6 + penaltyaddr + penaltyd;
+            break;
+        case 0xB2: // lda ind0
+            penaltyd = 0;
+            ind0_m16x8();
+            lda_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xB3: // lda sridy
+            penaltyaddr = 0;
+            sridy_m16x8();
+            lda_m16x8();
+            clockticks6502 += 8 + penaltyaddr;
+            break;
+        case 0xB4: // ldy zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            ldy_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xB5: // lda zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            lda_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xB6: // ldx zpy
+            penaltyd = 0;
+            zpy_m16x8();
+            ldx_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xB7: // lda indly
+            penaltyd = 0;
+            indly_m16x8();
+            lda_m16x8();
+            clockticks6502 += 7 + penaltyd;
+            break;
+        case 0xB8: // clv imp
+            imp_m16x8();
+            clv_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xB9: // lda absy
+            penaltyaddr = 0;
+            absy_m16x8();
+            lda_m16x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xBA: // tsx imp
+            imp_m16x8();
+            tsx_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xBB: // tyx imp
+            imp_m16x8();
+            tyx_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xBC: // ldy absx
+            penaltyaddr = 0;
+            absx_m16x8();
+            ldy_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBD: // lda absx
+            penaltyaddr = 0;
+            absx_m16x8();
+            lda_m16x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xBE: // ldx absy
+            penaltyaddr = 0;
+            absy_m16x8();
+            ldx_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBF: // lda abslx
+            penaltyaddr = 0;
+            abslx_m16x8();
+            lda_m16x8();
+            clockticks6502 += 6 + penaltyaddr;
+            break;
+        case 0xC0: // cpy immx
+            immx_m16x8();
+            cpy_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xC1: // cmp indx
+            penaltyd = 0;
+            indx_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xC2: // rep imm8
+            imm8_m16x8();
+            rep_m16x8();
+            clockticks6502 += 3;
+            break;
+        case 0xC3: // cmp sr
+            sr_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0xC4: // cpy zp
+            penaltyd = 0;
+            zp_m16x8();
+            cpy_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xC5: // cmp zp
+            penaltyd = 0;
+            zp_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xC6: // dec zp
+            penaltyd = 0;
+            zp_m16x8();
+            dec_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xC7: // cmp indl0
+            penaltyd = 0;
+            indl0_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xC8: // iny imp
+            imp_m16x8();
+            iny_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xC9: // cmp immm
+            immm_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xCA: // dex imp
+            imp_m16x8();
+            dex_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xCB: // wai imp
+            imp_m16x8();
+            wai_m16x8();
+            clockticks6502 += 3;
+            break;
+        case 0xCC: // cpy abso
+            abso_m16x8();
+            cpy_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0xCD: // cmp abso
+            abso_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0xCE: // dec abso
+            abso_m16x8();
+            dec_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0xCF: // cmp absl
+            absl_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0xD0: // bne rel
+            rel_m16x8();
+            bne_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xD1: // cmp indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xD2: // cmp ind0
+            penaltyd = 0;
+            ind0_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xD3: // cmp sridy
+            penaltyaddr = 0;
+            sridy_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0xD4: // pei ind0p
+            penaltyd = 0;
+            ind0p_m16x8();
+            pei_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD5: // cmp zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xD6: // dec zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            dec_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD7: // cmp indly
+            penaltyd = 0;
+            indly_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD8: // cld imp
+            imp_m16x8();
+            cld_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xD9: // cmp absy
+            penaltyaddr = 0;
+            absy_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xDA: // phx imp
+            imp_m16x8();
+            phx_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0xDB: // dbg imp
+            imp_m16x8();
+            dbg_m16x8();
+            clockticks6502 += 1;
+            break;
+        case 0xDC: // jml aindl
+            aindl_m16x8();
+            jml_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0xDD: // cmp absx
+            penaltyaddr = 0;
+            absx_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xDE: // dec absx
+            absx_m16x8();
+            dec_m16x8();
+            clockticks6502 += 7;
+            break;
+        case 0xDF: // cmp abslx
+            penaltyaddr = 0;
+            abslx_m16x8();
+            cmp_m16x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xE0: // cpx immx
+            immx_m16x8();
+            cpx_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xE1: // sbc indx
+            penaltyd = 0;
+            indx_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xE2: // sep imm8
+            imm8_m16x8();
+            sep_m16x8();
+            clockticks6502 += 3;
+            break;
+        case 0xE3: // sbc sr
+            sr_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0xE4: // cpx zp
+            penaltyd = 0;
+            zp_m16x8();
+            cpx_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xE5: // sbc zp
+            penaltyd = 0;
+            zp_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xE6: // inc zp
+            penaltyd = 0;
+            zp_m16x8();
+            inc_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xE7: // sbc indl0
+            penaltyd = 0;
+            indl0_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xE8: // inx imp
+            imp_m16x8();
+            inx_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xE9: // sbc immm
+            immm_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xEA: // nop imp
+            imp_m16x8();
+            nop_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xEB: // xba imp
+            imp_m16x8();
+            xba_m16x8();
+            clockticks6502 += 3;
+            break;
+        case 0xEC: // cpx abso
+            abso_m16x8();
+            cpx_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0xED: // sbc abso
+            abso_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 4;
+            break;
+        case 0xEE: // inc abso
+            abso_m16x8();
+            inc_m16x8();
+            clockticks6502 += 6;
+            break;
+        case 0xEF: // sbc absl
+            absl_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0xF0: // beq rel
+            rel_m16x8();
+            beq_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xF1: // sbc indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xF2: // sbc ind0
+            penaltyd = 0;
+            ind0_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xF3: // sbc sridy
+            penaltyaddr = 0;
+            sridy_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0xF4: // pea imm16
+            imm16_m16x8();
+            pea_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0xF5: // sbc zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xF6: // inc zpx
+            penaltyd = 0;
+            zpx_m16x8();
+            inc_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xF7: // sbc indly
+            penaltyd = 0;
+            indly_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xF8: // sed imp
+            imp_m16x8();
+            sed_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xF9: // sbc absy
+            penaltyaddr = 0;
+            absy_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xFA: // plx imp
+            imp_m16x8();
+            plx_m16x8();
+            clockticks6502 += 5;
+            break;
+        case 0xFB: // xce imp
+            imp_m16x8();
+            xce_m16x8();
+            clockticks6502 += 2;
+            break;
+        case 0xFC: // jsr ainx
+            ainx_m16x8();
+            jsr_m16x8();
+            clockticks6502 += 8;
+            break;
+        case 0xFD: // sbc absx
+            penaltyaddr = 0;
+            absx_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xFE: // inc absx
+            absx_m16x8();
+            inc_m16x8();
+            clockticks6502 += 7;
+            break;
+        case 0xFF: // sbc abslx
+            penaltyaddr = 0;
+            abslx_m16x8();
+            sbc_m16x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+    }
+}
+
+static const uint8_t oplength_c816_m16x8[256] = {
+    /* 0 */ 0x81, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 1 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 2 */ 0x83, 0x02, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02, 0x81, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 3 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 4 */ 0x81, 0x02, 0x02, 0x02, 0x83, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x83, 0x03, 0x03, 0x04,
+    /* 5 */ 0x82, 0x02, 0x02, 0x02, 0x83, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x84, 0x03, 0x03, 0x04,
+    /* 6 */ 0x81, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04,
+    /* 7 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x83, 0x03, 0x03, 0x04,
+    /* 8 */ 0x82, 0x02, 0x83, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 9 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* A */ 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* B */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* C */ 0x02, 0x02, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x03, 0x03, 0x03, 0x04,
+    /* D */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04,
+    /* E */ 0x02, 0x02, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* F */ 0x82, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04
 };
 
-static const uint32_t ticktable_c02[256] = {
-/*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
-/* 0 */       7,    6,    2,    1,    5,    3,    5,    5,    3,    2,    2,    1,    6,    4,    6,    5, /* 0 */
-/* 1 */       2,    5,    5,    1,    5,    4,    6,    5,    2,    4,    2,    1,    6,    4,    7,    5, /* 1 */
-/* 2 */       6,    6,    2,    1,    3,    3,    5,    5,    4,    2,    2,    1,    4,    4,    6,    5, /* 2 */
-/* 3 */       2,    5,    5,    1,    4,    4,    6,    5,    2,    4,    2,    1,    4,    4,    7,    5, /* 3 */
-/* 4 */       6,    6,    2,    1,    3,    3,    5,    5,    3,    2,    2,    1,    3,    4,    6,    5, /* 4 */
-/* 5 */       2,    5,    5,    1,    4,    4,    6,    5,    2,    4,    3,    1,    8,    4,    7,    5, /* 5 */
-/* 6 */       6,    6,    2,    1,    3,    3,    5,    5,    4,    2,    2,    1,    5,    4,    6,    5, /* 6 */
-/* 7 */       2,    5,    5,    1,    4,    4,    6,    5,    2,    4,    4,    1,    6,    4,    7,    5, /* 7 */
-/* 8 */       3,    6,    2,    1,    3,    3,    3,    5,    2,    2,    2,    1,    4,    4,    4,    5, /* 8 */
-/* 9 */       2,    6,    5,    1,    4,    4,    4,    5,    2,    5,    2,    1,    4,    5,    5,    5, /* 9 */
-/* A */       2,    6,    2,    1,    3,    3,    3,    5,    2,    2,    2,    1,    4,    4,    4,    5, /* A */
-/* B */       2,    5,    5,    1,    4,    4,    4,    5,    2,    4,    2,    1,    4,    4,    4,    5, /* B */
-/* C */       2,    6,    2,    1,    3,    3,    5,    5,    2,    2,    2,    3,    4,    4,    6,    5, /* C */
-/* D */       2,    5,    5,    1,    4,    4,    6,    5,    2,    4,    3,    1,    4,    4,    7,    5, /* D */
-/* E */       2,    6,    2,    1,    3,    3,    5,    5,    2,    2,    2,    1,    4,    4,    6,    5, /* E */
-/* F */       2,    5,    5,    1,    4,    4,    6,    5,    2,    4,    4,    1,    4,    4,    7,    5  /* F */
+static void interpret_c816_m8x16() {
+    switch (opcode) {
+        case 0x00: // brk imp8
+            imp8_m8x16();
+            brk_m8x16();
+            clockticks6502 += 8;
+            break;
+        case 0x01: // ora indx
+            penaltyd = 0;
+            indx_m8x16();
+            ora_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x02: // cop imp8
+            imp8_m8x16();
+            cop_m8x16();
+            clockticks6502 += 8;
+            break;
+        case 0x03: // ora sr
+            sr_m8x16();
+            ora_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x04: // tsb zp
+            penaltyd = 0;
+            zp_m8x16();
+            tsb_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x05: // ora zp
+            penaltyd = 0;
+            zp_m8x16();
+            ora_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x06: // asl zp
+            penaltyd = 0;
+            zp_m8x16();
+            asl_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x07: // ora indl0
+            penaltyd = 0;
+            indl0_m8x16();
+            ora_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x08: // php imp
+            imp_m8x16();
+            php_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0x09: // ora immm
+            immm_m8x16();
+            ora_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x0A: // asl acc
+            acc_m8x16();
+            asl_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x0B: // phd imp
+            imp_m8x16();
+            phd_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x0C: // tsb abso
+            abso_m8x16();
+            tsb_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0x0D: // ora abso
+            abso_m8x16();
+            ora_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x0E: // asl abso
+            abso_m8x16();
+            asl_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0x0F: // ora absl
+            absl_m8x16();
+            ora_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0x10: // bpl rel
+            rel_m8x16();
+            bpl_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x11: // ora indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x16();
+            ora_m8x16();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x12: // ora ind0
+            penaltyd = 0;
+            ind0_m8x16();
+            ora_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x13: // ora sridy
+            penaltyaddr = 0;
+            sridy_m8x16();
+            ora_m8x16();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x14: // trb zp
+            penaltyd = 0;
+            zp_m8x16();
+            trb_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x15: // ora zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            ora_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x16: // asl zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            asl_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x17: // ora indly
+            penaltyd = 0;
+            indly_m8x16();
+            ora_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x18: // clc imp
+            imp_m8x16();
+            clc_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x19: // ora absy
+            penaltyaddr = 0;
+            absy_m8x16();
+            ora_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x1A: // inc acc
+            acc_m8x16();
+            inc_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x1B: // tcs imp
+            imp_m8x16();
+            tcs_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x1C: // trb abso
+            abso_m8x16();
+            trb_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0x1D: // ora absx
+            penaltyaddr = 0;
+            absx_m8x16();
+            ora_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x1E: // asl absx
+            absx_m8x16();
+            asl_m8x16();
+            clockticks6502 += 7;
+            break;
+        case 0x1F: // ora abslx
+            penaltyaddr = 0;
+            abslx_m8x16();
+            ora_m8x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x20: // jsr abso
+            abso_m8x16();
+            jsr_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0x21: // and indx
+            penaltyd = 0;
+            indx_m8x16();
+            and_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x22: // jsl absl
+            absl_m8x16();
+            jsl_m8x16();
+            clockticks6502 += 8;
+            break;
+        case 0x23: // and sr
+            sr_m8x16();
+            and_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x24: // bit zp
+            penaltyd = 0;
+            zp_m8x16();
+            bit_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x25: // and zp
+            penaltyd = 0;
+            zp_m8x16();
+            and_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x26: // rol zp
+            penaltyd = 0;
+            zp_m8x16();
+            rol_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x27: // and indl0
+            penaltyd = 0;
+            indl0_m8x16();
+            and_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x28: // plp imp
+            imp_m8x16();
+            plp_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x29: // and immm
+            immm_m8x16();
+            and_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x2A: // rol acc
+            acc_m8x16();
+            rol_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x2B: // pld imp
+            imp_m8x16();
+            pld_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0x2C: // bit abso
+            abso_m8x16();
+            bit_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x2D: // and abso
+            abso_m8x16();
+            and_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x2E: // rol abso
+            abso_m8x16();
+            rol_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0x2F: // and absl
+            absl_m8x16();
+            and_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0x30: // bmi rel
+            rel_m8x16();
+            bmi_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x31: // and indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x16();
+            and_m8x16();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x32: // and ind0
+            penaltyd = 0;
+            ind0_m8x16();
+            and_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x33: // and sridy
+            penaltyaddr = 0;
+            sridy_m8x16();
+            and_m8x16();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x34: // bit zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            bit_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x35: // and zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            and_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x36: // rol zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            rol_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x37: // and indly
+            penaltyd = 0;
+            indly_m8x16();
+            and_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x38: // sec imp
+            imp_m8x16();
+            sec_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x39: // and absy
+            penaltyaddr = 0;
+            absy_m8x16();
+            and_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x3A: // dec acc
+            acc_m8x16();
+            dec_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x3B: // tsc imp
+            imp_m8x16();
+            tsc_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x3C: // bit absx
+            absx_m8x16();
+            bit_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x3D: // and absx
+            penaltyaddr = 0;
+            absx_m8x16();
+            and_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x3E: // rol absx
+            absx_m8x16();
+            rol_m8x16();
+            clockticks6502 += 7;
+            break;
+        case 0x3F: // and abslx
+            penaltyaddr = 0;
+            abslx_m8x16();
+            and_m8x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x40: // rti imp
+            imp_m8x16();
+            rti_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0x41: // eor indx
+            penaltyd = 0;
+            indx_m8x16();
+            eor_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x42: // wdm imm8
+            imm8_m8x16();
+            wdm_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x43: // eor sr
+            sr_m8x16();
+            eor_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x44: // mvp bmv
+            bmv_m8x16();
+            mvp_m8x16();
+            clockticks6502 += 7;
+            break;
+        case 0x45: // eor zp
+            penaltyd = 0;
+            zp_m8x16();
+            eor_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x46: // lsr zp
+            penaltyd = 0;
+            zp_m8x16();
+            lsr_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x47: // eor indl0
+            penaltyd = 0;
+            indl0_m8x16();
+            eor_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x48: // pha imp
+            imp_m8x16();
+            pha_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0x49: // eor immm
+            immm_m8x16();
+            eor_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x4A: // lsr acc
+            acc_m8x16();
+            lsr_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x4B: // phk imp
+            imp_m8x16();
+            phk_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0x4C: // jmp abso
+            abso_m8x16();
+            jmp_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0x4D: // eor abso
+            abso_m8x16();
+            eor_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x4E: // lsr abso
+            abso_m8x16();
+            lsr_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0x4F: // eor absl
+            absl_m8x16();
+            eor_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0x50: // bvc rel
+            rel_m8x16();
+            bvc_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x51: // eor indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x16();
+            eor_m8x16();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x52: // eor ind0
+            penaltyd = 0;
+            ind0_m8x16();
+            eor_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x53: // eor sridy
+            penaltyaddr = 0;
+            sridy_m8x16();
+            eor_m8x16();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x54: // mvn bmv
+            bmv_m8x16();
+            mvn_m8x16();
+            clockticks6502 += 7;
+            break;
+        case 0x55: // eor zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            eor_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x56: // lsr zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            lsr_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x57: // eor indly
+            penaltyd = 0;
+            indly_m8x16();
+            eor_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x58: // cli imp
+            imp_m8x16();
+            cli_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x59: // eor absy
+            penaltyaddr = 0;
+            absy_m8x16();
+            eor_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x5A: // phy imp
+            imp_m8x16();
+            phy_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0x5B: // tcd imp
+            imp_m8x16();
+            tcd_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x5C: // jml absl
+            absl_m8x16();
+            jml_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x5D: // eor absx
+            penaltyaddr = 0;
+            absx_m8x16();
+            eor_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x5E: // lsr absx
+            absx_m8x16();
+            lsr_m8x16();
+            clockticks6502 += 7;
+            break;
+        case 0x5F: // eor abslx
+            penaltyaddr = 0;
+            abslx_m8x16();
+            eor_m8x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x60: // rts imp
+            imp_m8x16();
+            rts_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0x61: // adc indx
+            penaltyd = 0;
+            indx_m8x16();
+            adc_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x62: // per rel16
+            rel16_m8x16();
+            per_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0x63: // adc sr
+            sr_m8x16();
+            adc_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x64: // stz zp
+            penaltyd = 0;
+            zp_m8x16();
+            stz_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x65: // adc zp
+            penaltyd = 0;
+            zp_m8x16();
+            adc_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x66: // ror zp
+            penaltyd = 0;
+            zp_m8x16();
+            ror_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x67: // adc indl0
+            penaltyd = 0;
+            indl0_m8x16();
+            adc_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x68: // pla imp
+            imp_m8x16();
+            pla_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x69: // adc immm
+            immm_m8x16();
+            adc_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x6A: // ror acc
+            acc_m8x16();
+            ror_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x6B: // rtl imp
+            imp_m8x16();
+            rtl_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0x6C: // jmp ind
+            ind_m8x16();
+            jmp_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0x6D: // adc abso
+            abso_m8x16();
+            adc_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x6E: // ror abso
+            abso_m8x16();
+            ror_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0x6F: // adc absl
+            absl_m8x16();
+            adc_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0x70: // bvs rel
+            rel_m8x16();
+            bvs_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x71: // adc indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x16();
+            adc_m8x16();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x72: // adc ind0
+            penaltyd = 0;
+            ind0_m8x16();
+            adc_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x73: // adc sridy
+            penaltyaddr = 0;
+            sridy_m8x16();
+            adc_m8x16();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x74: // stz zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            stz_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x75: // adc zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            adc_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x76: // ror zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            ror_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x77: // adc indly
+            penaltyd = 0;
+            indly_m8x16();
+            adc_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x78: // sei imp
+            imp_m8x16();
+            sei_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x79: // adc absy
+            penaltyaddr = 0;
+            absy_m8x16();
+            adc_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x7A: // ply imp
+            imp_m8x16();
+            ply_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x7B: // tdc imp
+            imp_m8x16();
+            tdc_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x7C: // jmp ainx
+            ainx_m8x16();
+            jmp_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0x7D: // adc absx
+            penaltyaddr = 0;
+            absx_m8x16();
+            adc_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x7E: // ror absx
+            absx_m8x16();
+            ror_m8x16();
+            clockticks6502 += 7;
+            break;
+        case 0x7F: // adc abslx
+            penaltyaddr = 0;
+            abslx_m8x16();
+            adc_m8x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x80: // bra rel
+            rel_m8x16();
+            bra_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0x81: // sta indx
+            penaltyd = 0;
+            indx_m8x16();
+            sta_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x82: // brl rel16
+            rel16_m8x16();
+            brl_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x83: // sta sr
+            sr_m8x16();
+            sta_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x84: // sty zp
+            penaltyd = 0;
+            zp_m8x16();
+            sty_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x85: // sta zp
+            penaltyd = 0;
+            zp_m8x16();
+            sta_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x86: // stx zp
+            penaltyd = 0;
+            zp_m8x16();
+            stx_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x87: // sta indl0
+            penaltyd = 0;
+            indl0_m8x16();
+            sta_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x88: // dey imp
+            imp_m8x16();
+            dey_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x89: // bit immm
+            immm_m8x16();
+            bit_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x8A: // txa imp
+            imp_m8x16();
+            txa_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x8B: // phb imp
+            imp_m8x16();
+            phb_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0x8C: // sty abso
+            abso_m8x16();
+            sty_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x8D: // sta abso
+            abso_m8x16();
+            sta_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x8E: // stx abso
+            abso_m8x16();
+            stx_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x8F: // sta absl
+            absl_m8x16();
+            sta_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0x90: // bcc rel
+            rel_m8x16();
+            bcc_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x91: // sta indy
+            penaltyd = 0;
+            indy_m8x16();
+            sta_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x92: // sta ind0
+            penaltyd = 0;
+            ind0_m8x16();
+            sta_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x93: // sta sridy
+            sridy_m8x16();
+            sta_m8x16();
+            clockticks6502 += 7;
+            break;
+        case 0x94: // sty zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            sty_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x95: // sta zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            sta_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x96: // stx zpy
+            penaltyd = 0;
+            zpy_m8x16();
+            stx_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x97: // sta indly
+            penaltyd = 0;
+            indly_m8x16();
+            sta_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x98: // tya imp
+            imp_m8x16();
+            tya_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x99: // sta absy
+            absy_m8x16();
+            sta_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0x9A: // txs imp
+            imp_m8x16();
+            txs_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x9B: // txy imp
+            imp_m8x16();
+            txy_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0x9C: // stz abso
+            abso_m8x16();
+            stz_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0x9D: // sta absx
+            absx_m8x16();
+            sta_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0x9E: // stz absx
+            absx_m8x16();
+            stz_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0x9F: // sta abslx
+            abslx_m8x16();
+            sta_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0xA0: // ldy immx
+            immx_m8x16();
+            ldy_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0xA1: // lda indx
+            penaltyd = 0;
+            indx_m8x16();
+            lda_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xA2: // ldx immx
+            immx_m8x16();
+            ldx_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0xA3: // lda sr
+            sr_m8x16();
+            lda_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0xA4: // ldy zp
+            penaltyd = 0;
+            zp_m8x16();
+            ldy_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xA5: // lda zp
+            penaltyd = 0;
+            zp_m8x16();
+            lda_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xA6: // ldx zp
+            penaltyd = 0;
+            zp_m8x16();
+            ldx_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xA7: // lda indl0
+            penaltyd = 0;
+            indl0_m8x16();
+            lda_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xA8: // tay imp
+            imp_m8x16();
+            tay_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xA9: // lda immm
+            immm_m8x16();
+            lda_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xAA: // tax imp
+            imp_m8x16();
+            tax_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xAB: // plb imp
+            imp_m8x16();
+            plb_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0xAC: // ldy abso
+            abso_m8x16();
+            ldy_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0xAD: // lda abso
+            abso_m8x16();
+            lda_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0xAE: // ldx abso
+            abso_m8x16();
+            ldx_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0xAF: // lda absl
+            absl_m8x16();
+            lda_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0xB0: // bcs rel
+            rel_m8x16();
+            bcs_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xB1: // lda indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x16();
+            lda_m8x16();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xB2: // lda ind0
+            penaltyd = 0;
+            ind0_m8x16();
+            lda_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xB3: // lda sridy
+            penaltyaddr = 0;
+            sridy_m8x16();
+            lda_m8x16();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0xB4: // ldy zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            ldy_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xB5: // lda zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            lda_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xB6: // ldx zpy
+            penaltyd = 0;
+            zpy_m8x16();
+            ldx_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xB7: // lda indly
+            penaltyd = 0;
+            indly_m8x16();
+            lda_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xB8: // clv imp
+            imp_m8x16();
+            clv_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xB9: // lda absy
+            penaltyaddr = 0;
+            absy_m8x16();
+            lda_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBA: // tsx imp
+            imp_m8x16();
+            tsx_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xBB: // tyx imp
+            imp_m8x16();
+            tyx_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xBC: // ldy absx
+            penaltyaddr = 0;
+            absx_m8x16();
+            ldy_m8x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xBD: // lda absx
+            penaltyaddr = 0;
+            absx_m8x16();
+            lda_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBE: // ldx absy
+            penaltyaddr = 0;
+            absy_m8x16();
+            ldx_m8x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xBF: // lda abslx
+            penaltyaddr = 0;
+            abslx_m8x16();
+            lda_m8x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xC0: // cpy immx
+            immx_m8x16();
+            cpy_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xC1: // cmp indx
+            penaltyd = 0;
+            indx_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xC2: // rep imm8
+            imm8_m8x16();
+            rep_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0xC3: // cmp sr
+            sr_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0xC4: // cpy zp
+            penaltyd = 0;
+            zp_m8x16();
+            cpy_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xC5: // cmp zp
+            penaltyd = 0;
+            zp_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xC6: // dec zp
+            penaltyd = 0;
+            zp_m8x16();
+            dec_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xC7: // cmp indl0
+            penaltyd = 0;
+            indl0_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xC8: // iny imp
+            imp_m8x16();
+            iny_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xC9: // cmp immm
+            immm_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xCA: // dex imp
+            imp_m8x16();
+            dex_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xCB: // wai imp
+            imp_m8x16();
+            wai_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0xCC: // cpy abso
+            abso_m8x16();
+            cpy_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0xCD: // cmp abso
+            abso_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0xCE: // dec abso
+            abso_m8x16();
+            dec_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0xCF: // cmp absl
+            absl_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0xD0: // bne rel
+            rel_m8x16();
+            bne_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xD1: // cmp indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xD2: // cmp ind0
+            penaltyd = 0;
+            ind0_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xD3: // cmp sridy
+            penaltyaddr = 0;
+            sridy_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0xD4: // pei ind0p
+            penaltyd = 0;
+            ind0p_m8x16();
+            pei_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD5: // cmp zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xD6: // dec zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            dec_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD7: // cmp indly
+            penaltyd = 0;
+            indly_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD8: // cld imp
+            imp_m8x16();
+            cld_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xD9: // cmp absy
+            penaltyaddr = 0;
+            absy_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xDA: // phx imp
+            imp_m8x16();
+            phx_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0xDB: // dbg imp
+            imp_m8x16();
+            dbg_m8x16();
+            clockticks6502 += 1;
+            break;
+        case 0xDC: // jml aindl
+            aindl_m8x16();
+            jml_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0xDD: // cmp absx
+            penaltyaddr = 0;
+            absx_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xDE: // dec absx
+            absx_m8x16();
+            dec_m8x16();
+            clockticks6502 += 7;
+            break;
+        case 0xDF: // cmp abslx
+            penaltyaddr = 0;
+            abslx_m8x16();
+            cmp_m8x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xE0: // cpx immx
+            immx_m8x16();
+            cpx_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xE1: // sbc indx
+            penaltyd = 0;
+            indx_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xE2: // sep imm8
+            imm8_m8x16();
+            sep_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0xE3: // sbc sr
+            sr_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0xE4: // cpx zp
+            penaltyd = 0;
+            zp_m8x16();
+            cpx_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xE5: // sbc zp
+            penaltyd = 0;
+            zp_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xE6: // inc zp
+            penaltyd = 0;
+            zp_m8x16();
+            inc_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xE7: // sbc indl0
+            penaltyd = 0;
+            indl0_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xE8: // inx imp
+            imp_m8x16();
+            inx_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xE9: // sbc immm
+            immm_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xEA: // nop imp
+            imp_m8x16();
+            nop_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xEB: // xba imp
+            imp_m8x16();
+            xba_m8x16();
+            clockticks6502 += 3;
+            break;
+        case 0xEC: // cpx abso
+            abso_m8x16();
+            cpx_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0xED: // sbc abso
+            abso_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0xEE: // inc abso
+            abso_m8x16();
+            inc_m8x16();
+            clockticks6502 += 6;
+            break;
+        case 0xEF: // sbc absl
+            absl_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0xF0: // beq rel
+            rel_m8x16();
+            beq_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xF1: // sbc indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xF2: // sbc ind0
+            penaltyd = 0;
+            ind0_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xF3: // sbc sridy
+            penaltyaddr = 0;
+            sridy_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0xF4: // pea imm16
+            imm16_m8x16();
+            pea_m8x16();
+            clockticks6502 += 5;
+            break;
+        case 0xF5: // sbc zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xF6: // inc zpx
+            penaltyd = 0;
+            zpx_m8x16();
+            inc_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xF7: // sbc indly
+            penaltyd = 0;
+            indly_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xF8: // sed imp
+            imp_m8x16();
+            sed_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xF9: // sbc absy
+            penaltyaddr = 0;
+            absy_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xFA: // plx imp
+            imp_m8x16();
+            plx_m8x16();
+            clockticks6502 += 4;
+            break;
+        case 0xFB: // xce imp
+            imp_m8x16();
+            xce_m8x16();
+            clockticks6502 += 2;
+            break;
+        case 0xFC: // jsr ainx
+            ainx_m8x16();
+            jsr_m8x16();
+            clockticks6502 += 8;
+            break;
+        case 0xFD: // sbc absx
+            penaltyaddr = 0;
+            absx_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xFE: // inc absx
+            absx_m8x16();
+            inc_m8x16();
+            clockticks6502 += 7;
+            break;
+        case 0xFF: // sbc abslx
+            penaltyaddr = 0;
+            abslx_m8x16();
+            sbc_m8x16();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+    }
+}
+
+static const uint8_t oplength_c816_m8x16[256] = {
+    /* 0 */ 0x81, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 1 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 2 */ 0x83, 0x02, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02, 0x81, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 3 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 4 */ 0x81, 0x02, 0x02, 0x02, 0x83, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x83, 0x03, 0x03, 0x04,
+    /* 5 */ 0x82, 0x02, 0x02, 0x02, 0x83, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x84, 0x03, 0x03, 0x04,
+    /* 6 */ 0x81, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04,
+    /* 7 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x83, 0x03, 0x03, 0x04,
+    /* 8 */ 0x82, 0x02, 0x83, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 9 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* A */ 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* B */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* C */ 0x03, 0x02, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x81, 0x03, 0x03, 0x03, 0x04,
+    /* D */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04,
+    /* E */ 0x03, 0x02, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* F */ 0x82, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04
 };
 
-static const uint32_t ticktable_c816[256] = {
-/*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
-/* 0 */       7,    6,    7,    4,    5,    3,    5,    6,    3,    2,    2,    4,    6,    4,    6,    5, /* 0 */
-/* 1 */       2,    5,    5,    7,    5,    4,    6,    6,    2,    4,    2,    2,    6,    4,    7,    5, /* 1 */
-/* 2 */       6,    6,    8,    4,    3,    3,    5,    6,    4,    2,    2,    5,    4,    4,    6,    5, /* 2 */
-/* 3 */       2,    5,    5,    7,    4,    4,    6,    6,    2,    4,    2,    2,    4,    4,    7,    5, /* 3 */
-/* 4 */       6,    6,    2,    4,    7,    3,    5,    6,    3,    2,    2,    3,    3,    4,    6,    5, /* 4 */
-/* 5 */       2,    5,    5,    7,    7,    4,    6,    6,    2,    4,    3,    2,    4,    4,    7,    5, /* 5 */
-/* 6 */       6,    6,    6,    4,    3,    3,    5,    6,    4,    2,    2,    6,    5,    4,    6,    5, /* 6 */
-/* 7 */       2,    5,    5,    7,    4,    4,    6,    6,    2,    4,    4,    2,    6,    4,    7,    5, /* 7 */
-/* 8 */       3,    6,    4,    4,    3,    3,    3,    6,    2,    2,    2,    3,    4,    4,    4,    5, /* 8 */
-/* 9 */       2,    6,    5,    7,    4,    4,    4,    6,    2,    5,    2,    2,    4,    5,    5,    5, /* 9 */
-/* A */       2,    6,    2,    4,    3,    3,    3,    6,    2,    2,    2,    4,    4,    4,    4,    5, /* A */
-/* B */       2,    5,    5,    7,    4,    4,    4,    6,    2,    4,    2,    2,    4,    4,    4,    5, /* B */
-/* C */       2,    6,    3,    4,    3,    3,    5,    6,    2,    2,    2,    3,    4,    4,    6,    5, /* C */
-/* D */       2,    5,    5,    7,    6,    4,    6,    6,    2,    4,    3,    1,    6,    4,    7,    5, /* D */
-/* E */       2,    6,    3,    4,    3,    3,    5,    6,    2,    2,    2,    3,    4,    4,    6,    5, /* E */
-/* F */       2,    5,    5,    7,    5,    4,    6,    6,    2,    4,    4,    2,    8,    4,    7,    5  /* F */
+static void interpret_c816_m8x8() {
+    switch (opcode) {
+        case 0x00: // brk imp8
+            imp8_m8x8();
+            brk_m8x8();
+            clockticks6502 += 8;
+            break;
+        case 0x01: // ora indx
+            penaltyd = 0;
+            indx_m8x8();
+            ora_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x02: // cop imp8
+            imp8_m8x8();
+            cop_m8x8();
+            clockticks6502 += 8;
+            break;
+        case 0x03: // ora sr
+            sr_m8x8();
+            ora_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x04: // tsb zp
+            penaltyd = 0;
+            zp_m8x8();
+            tsb_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x05: // ora zp
+            penaltyd = 0;
+            zp_m8x8();
+            ora_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x06: // asl zp
+            penaltyd = 0;
+            zp_m8x8();
+            asl_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x07: // ora indl0
+            penaltyd = 0;
+            indl0_m8x8();
+            ora_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x08: // php imp
+            imp_m8x8();
+            php_m8x8();
+            clockticks6502 += 3;
+            break;
+        case 0x09: // ora immm
+            immm_m8x8();
+            ora_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x0A: // asl acc
+            acc_m8x8();
+            asl_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x0B: // phd imp
+            imp_m8x8();
+            phd_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x0C: // tsb abso
+            abso_m8x8();
+            tsb_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0x0D: // ora abso
+            abso_m8x8();
+            ora_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x0E: // asl abso
+            abso_m8x8();
+            asl_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0x0F: // ora absl
+            absl_m8x8();
+            ora_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0x10: // bpl rel
+            rel_m8x8();
+            bpl_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x11: // ora indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x8();
+            ora_m8x8();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x12: // ora ind0
+            penaltyd = 0;
+            ind0_m8x8();
+            ora_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x13: // ora sridy
+            penaltyaddr = 0;
+            sridy_m8x8();
+            ora_m8x8();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x14: // trb zp
+            penaltyd = 0;
+            zp_m8x8();
+            trb_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x15: // ora zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            ora_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x16: // asl zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            asl_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x17: // ora indly
+            penaltyd = 0;
+            indly_m8x8();
+            ora_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x18: // clc imp
+            imp_m8x8();
+            clc_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x19: // ora absy
+            penaltyaddr = 0;
+            absy_m8x8();
+            ora_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x1A: // inc acc
+            acc_m8x8();
+            inc_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x1B: // tcs imp
+            imp_m8x8();
+            tcs_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x1C: // trb abso
+            abso_m8x8();
+            trb_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0x1D: // ora absx
+            penaltyaddr = 0;
+            absx_m8x8();
+            ora_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x1E: // asl absx
+            absx_m8x8();
+            asl_m8x8();
+            clockticks6502 += 7;
+            break;
+        case 0x1F: // ora abslx
+            penaltyaddr = 0;
+            abslx_m8x8();
+            ora_m8x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x20: // jsr abso
+            abso_m8x8();
+            jsr_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0x21: // and indx
+            penaltyd = 0;
+            indx_m8x8();
+            and_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x22: // jsl absl
+            absl_m8x8();
+            jsl_m8x8();
+            clockticks6502 += 8;
+            break;
+        case 0x23: // and sr
+            sr_m8x8();
+            and_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x24: // bit zp
+            penaltyd = 0;
+            zp_m8x8();
+            bit_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x25: // and zp
+            penaltyd = 0;
+            zp_m8x8();
+            and_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x26: // rol zp
+            penaltyd = 0;
+            zp_m8x8();
+            rol_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x27: // and indl0
+            penaltyd = 0;
+            indl0_m8x8();
+            and_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x28: // plp imp
+            imp_m8x8();
+            plp_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x29: // and immm
+            immm_m8x8();
+            and_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x2A: // rol acc
+            acc_m8x8();
+            rol_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x2B: // pld imp
+            imp_m8x8();
+            pld_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0x2C: // bit abso
+            abso_m8x8();
+            bit_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x2D: // and abso
+            abso_m8x8();
+            and_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x2E: // rol abso
+            abso_m8x8();
+            rol_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0x2F: // and absl
+            absl_m8x8();
+            and_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0x30: // bmi rel
+            rel_m8x8();
+            bmi_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x31: // and indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x8();
+            and_m8x8();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x32: // and ind0
+            penaltyd = 0;
+            ind0_m8x8();
+            and_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x33: // and sridy
+            penaltyaddr = 0;
+            sridy_m8x8();
+            and_m8x8();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x34: // bit zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            bit_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x35: // and zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            and_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x36: // rol zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            rol_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x37: // and indly
+            penaltyd = 0;
+            indly_m8x8();
+            and_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x38: // sec imp
+            imp_m8x8();
+            sec_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x39: // and absy
+            penaltyaddr = 0;
+            absy_m8x8();
+            and_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x3A: // dec acc
+            acc_m8x8();
+            dec_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x3B: // tsc imp
+            imp_m8x8();
+            tsc_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x3C: // bit absx
+            absx_m8x8();
+            bit_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x3D: // and absx
+            penaltyaddr = 0;
+            absx_m8x8();
+            and_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x3E: // rol absx
+            absx_m8x8();
+            rol_m8x8();
+            clockticks6502 += 7;
+            break;
+        case 0x3F: // and abslx
+            penaltyaddr = 0;
+            abslx_m8x8();
+            and_m8x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x40: // rti imp
+            imp_m8x8();
+            rti_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0x41: // eor indx
+            penaltyd = 0;
+            indx_m8x8();
+            eor_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x42: // wdm imm8
+            imm8_m8x8();
+            wdm_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x43: // eor sr
+            sr_m8x8();
+            eor_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x44: // mvp bmv
+            bmv_m8x8();
+            mvp_m8x8();
+            clockticks6502 += 7;
+            break;
+        case 0x45: // eor zp
+            penaltyd = 0;
+            zp_m8x8();
+            eor_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x46: // lsr zp
+            penaltyd = 0;
+            zp_m8x8();
+            lsr_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x47: // eor indl0
+            penaltyd = 0;
+            indl0_m8x8();
+            eor_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x48: // pha imp
+            imp_m8x8();
+            pha_m8x8();
+            clockticks6502 += 3;
+            break;
+        case 0x49: // eor immm
+            immm_m8x8();
+            eor_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x4A: // lsr acc
+            acc_m8x8();
+            lsr_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x4B: // phk imp
+            imp_m8x8();
+            phk_m8x8();
+            clockticks6502 += 3;
+            break;
+        case 0x4C: // jmp abso
+            abso_m8x8();
+            jmp_m8x8();
+            clockticks6502 += 3;
+            break;
+        case 0x4D: // eor abso
+            abso_m8x8();
+            eor_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x4E: // lsr abso
+            abso_m8x8();
+            lsr_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0x4F: // eor absl
+            absl_m8x8();
+            eor_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0x50: // bvc rel
+            rel_m8x8();
+            bvc_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x51: // eor indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x8();
+            eor_m8x8();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x52: // eor ind0
+            penaltyd = 0;
+            ind0_m8x8();
+            eor_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x53: // eor sridy
+            penaltyaddr = 0;
+            sridy_m8x8();
+            eor_m8x8();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x54: // mvn bmv
+            bmv_m8x8();
+            mvn_m8x8();
+            clockticks6502 += 7;
+            break;
+        case 0x55: // eor zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            eor_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x56: // lsr zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            lsr_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x57: // eor indly
+            penaltyd = 0;
+            indly_m8x8();
+            eor_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x58: // cli imp
+            imp_m8x8();
+            cli_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x59: // eor absy
+            penaltyaddr = 0;
+            absy_m8x8();
+            eor_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x5A: // phy imp
+            imp_m8x8();
+            phy_m8x8();
+            clockticks6502 += 3;
+            break;
+        case 0x5B: // tcd imp
+            imp_m8x8();
+            tcd_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x5C: // jml absl
+            absl_m8x8();
+            jml_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x5D: // eor absx
+            penaltyaddr = 0;
+            absx_m8x8();
+            eor_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x5E: // lsr absx
+            absx_m8x8();
+            lsr_m8x8();
+            clockticks6502 += 7;
+            break;
+        case 0x5F: // eor abslx
+            penaltyaddr = 0;
+            abslx_m8x8();
+            eor_m8x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x60: // rts imp
+            imp_m8x8();
+            rts_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0x61: // adc indx
+            penaltyd = 0;
+            indx_m8x8();
+            adc_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x62: // per rel16
+            rel16_m8x8();
+            per_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0x63: // adc sr
+            sr_m8x8();
+            adc_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x64: // stz zp
+            penaltyd = 0;
+            zp_m8x8();
+            stz_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x65: // adc zp
+            penaltyd = 0;
+            zp_m8x8();
+            adc_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x66: // ror zp
+            penaltyd = 0;
+            zp_m8x8();
+            ror_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x67: // adc indl0
+            penaltyd = 0;
+            indl0_m8x8();
+            adc_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x68: // pla imp
+            imp_m8x8();
+            pla_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x69: // adc immm
+            immm_m8x8();
+            adc_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x6A: // ror acc
+            acc_m8x8();
+            ror_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x6B: // rtl imp
+            imp_m8x8();
+            rtl_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0x6C: // jmp ind
+            ind_m8x8();
+            jmp_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0x6D: // adc abso
+            abso_m8x8();
+            adc_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x6E: // ror abso
+            abso_m8x8();
+            ror_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0x6F: // adc absl
+            absl_m8x8();
+            adc_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0x70: // bvs rel
+            rel_m8x8();
+            bvs_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x71: // adc indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x8();
+            adc_m8x8();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0x72: // adc ind0
+            penaltyd = 0;
+            ind0_m8x8();
+            adc_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x73: // adc sridy
+            penaltyaddr = 0;
+            sridy_m8x8();
+            adc_m8x8();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0x74: // stz zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            stz_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x75: // adc zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            adc_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x76: // ror zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            ror_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x77: // adc indly
+            penaltyd = 0;
+            indly_m8x8();
+            adc_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x78: // sei imp
+            imp_m8x8();
+            sei_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x79: // adc absy
+            penaltyaddr = 0;
+            absy_m8x8();
+            adc_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x7A: // ply imp
+            imp_m8x8();
+            ply_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x7B: // tdc imp
+            imp_m8x8();
+            tdc_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x7C: // jmp ainx
+            ainx_m8x8();
+            jmp_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0x7D: // adc absx
+            penaltyaddr = 0;
+            absx_m8x8();
+            adc_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0x7E: // ror absx
+            absx_m8x8();
+            ror_m8x8();
+            clockticks6502 += 7;
+            break;
+        case 0x7F: // adc abslx
+            penaltyaddr = 0;
+            abslx_m8x8();
+            adc_m8x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0x80: // bra rel
+            rel_m8x8();
+            bra_m8x8();
+            clockticks6502 += 3;
+            break;
+        case 0x81: // sta indx
+            penaltyd = 0;
+            indx_m8x8();
+            sta_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x82: // brl rel16
+            rel16_m8x8();
+            brl_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x83: // sta sr
+            sr_m8x8();
+            sta_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x84: // sty zp
+            penaltyd = 0;
+            zp_m8x8();
+            sty_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x85: // sta zp
+            penaltyd = 0;
+            zp_m8x8();
+            sta_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x86: // stx zp
+            penaltyd = 0;
+            zp_m8x8();
+            stx_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0x87: // sta indl0
+            penaltyd = 0;
+            indl0_m8x8();
+            sta_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x88: // dey imp
+            imp_m8x8();
+            dey_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x89: // bit immm
+            immm_m8x8();
+            bit_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x8A: // txa imp
+            imp_m8x8();
+            txa_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x8B: // phb imp
+            imp_m8x8();
+            phb_m8x8();
+            clockticks6502 += 3;
+            break;
+        case 0x8C: // sty abso
+            abso_m8x8();
+            sty_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x8D: // sta abso
+            abso_m8x8();
+            sta_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x8E: // stx abso
+            abso_m8x8();
+            stx_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x8F: // sta absl
+            absl_m8x8();
+            sta_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0x90: // bcc rel
+            rel_m8x8();
+            bcc_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x91: // sta indy
+            penaltyd = 0;
+            indy_m8x8();
+            sta_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x92: // sta ind0
+            penaltyd = 0;
+            ind0_m8x8();
+            sta_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0x93: // sta sridy
+            sridy_m8x8();
+            sta_m8x8();
+            clockticks6502 += 7;
+            break;
+        case 0x94: // sty zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            sty_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x95: // sta zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            sta_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x96: // stx zpy
+            penaltyd = 0;
+            zpy_m8x8();
+            stx_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0x97: // sta indly
+            penaltyd = 0;
+            indly_m8x8();
+            sta_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0x98: // tya imp
+            imp_m8x8();
+            tya_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x99: // sta absy
+            absy_m8x8();
+            sta_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0x9A: // txs imp
+            imp_m8x8();
+            txs_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x9B: // txy imp
+            imp_m8x8();
+            txy_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0x9C: // stz abso
+            abso_m8x8();
+            stz_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0x9D: // sta absx
+            absx_m8x8();
+            sta_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0x9E: // stz absx
+            absx_m8x8();
+            stz_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0x9F: // sta abslx
+            abslx_m8x8();
+            sta_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0xA0: // ldy immx
+            immx_m8x8();
+            ldy_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xA1: // lda indx
+            penaltyd = 0;
+            indx_m8x8();
+            lda_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xA2: // ldx immx
+            immx_m8x8();
+            ldx_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xA3: // lda sr
+            sr_m8x8();
+            lda_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0xA4: // ldy zp
+            penaltyd = 0;
+            zp_m8x8();
+            ldy_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xA5: // lda zp
+            penaltyd = 0;
+            zp_m8x8();
+            lda_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xA6: // ldx zp
+            penaltyd = 0;
+            zp_m8x8();
+            ldx_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xA7: // lda indl0
+            penaltyd = 0;
+            indl0_m8x8();
+            lda_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xA8: // tay imp
+            imp_m8x8();
+            tay_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xA9: // lda immm
+            immm_m8x8();
+            lda_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xAA: // tax imp
+            imp_m8x8();
+            tax_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xAB: // plb imp
+            imp_m8x8();
+            plb_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0xAC: // ldy abso
+            abso_m8x8();
+            ldy_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0xAD: // lda abso
+            abso_m8x8();
+            lda_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0xAE: // ldx abso
+            abso_m8x8();
+            ldx_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0xAF: // lda absl
+            absl_m8x8();
+            lda_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0xB0: // bcs rel
+            rel_m8x8();
+            bcs_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xB1: // lda indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x8();
+            lda_m8x8();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xB2: // lda ind0
+            penaltyd = 0;
+            ind0_m8x8();
+            lda_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xB3: // lda sridy
+            penaltyaddr = 0;
+            sridy_m8x8();
+            lda_m8x8();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0xB4: // ldy zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            ldy_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xB5: // lda zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            lda_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xB6: // ldx zpy
+            penaltyd = 0;
+            zpy_m8x8();
+            ldx_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xB7: // lda indly
+            penaltyd = 0;
+            indly_m8x8();
+            lda_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xB8: // clv imp
+            imp_m8x8();
+            clv_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xB9: // lda absy
+            penaltyaddr = 0;
+            absy_m8x8();
+            lda_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBA: // tsx imp
+            imp_m8x8();
+            tsx_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xBB: // tyx imp
+            imp_m8x8();
+            tyx_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xBC: // ldy absx
+            penaltyaddr = 0;
+            absx_m8x8();
+            ldy_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBD: // lda absx
+            penaltyaddr = 0;
+            absx_m8x8();
+            lda_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBE: // ldx absy
+            penaltyaddr = 0;
+            absy_m8x8();
+            ldx_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xBF: // lda abslx
+            penaltyaddr = 0;
+            abslx_m8x8();
+            lda_m8x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xC0: // cpy immx
+            immx_m8x8();
+            cpy_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xC1: // cmp indx
+            penaltyd = 0;
+            indx_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xC2: // rep imm8
+            imm8_m8x8();
+            rep_m8x8();
+            clockticks6502 += 3;
+            break;
+        case 0xC3: // cmp sr
+            sr_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0xC4: // cpy zp
+            penaltyd = 0;
+            zp_m8x8();
+            cpy_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xC5: // cmp zp
+            penaltyd = 0;
+            zp_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xC6: // dec zp
+            penaltyd = 0;
+            zp_m8x8();
+            dec_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xC7: // cmp indl0
+            penaltyd = 0;
+            indl0_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xC8: // iny imp
+            imp_m8x8();
+            iny_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xC9: // cmp immm
+            immm_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xCA: // dex imp
+            imp_m8x8();
+            dex_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xCB: // wai imp
+            imp_m8x8();
+            wai_m8x8();
+            clockticks6502 += 3;
+            break;
+        case 0xCC: // cpy abso
+            abso_m8x8();
+            cpy_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0xCD: // cmp abso
+            abso_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0xCE: // dec abso
+            abso_m8x8();
+            dec_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0xCF: // cmp absl
+            absl_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0xD0: // bne rel
+            rel_m8x8();
+            bne_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xD1: // cmp indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xD2: // cmp ind0
+            penaltyd = 0;
+            ind0_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xD3: // cmp sridy
+            penaltyaddr = 0;
+            sridy_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0xD4: // pei ind0p
+            penaltyd = 0;
+            ind0p_m8x8();
+            pei_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD5: // cmp zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xD6: // dec zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            dec_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD7: // cmp indly
+            penaltyd = 0;
+            indly_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xD8: // cld imp
+            imp_m8x8();
+            cld_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xD9: // cmp absy
+            penaltyaddr = 0;
+            absy_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xDA: // phx imp
+            imp_m8x8();
+            phx_m8x8();
+            clockticks6502 += 3;
+            break;
+        case 0xDB: // dbg imp
+            imp_m8x8();
+            dbg_m8x8();
+            clockticks6502 += 1;
+            break;
+        case 0xDC: // jml aindl
+            aindl_m8x8();
+            jml_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0xDD: // cmp absx
+            penaltyaddr = 0;
+            absx_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xDE: // dec absx
+            absx_m8x8();
+            dec_m8x8();
+            clockticks6502 += 7;
+            break;
+        case 0xDF: // cmp abslx
+            penaltyaddr = 0;
+            abslx_m8x8();
+            cmp_m8x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+        case 0xE0: // cpx immx
+            immx_m8x8();
+            cpx_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xE1: // sbc indx
+            penaltyd = 0;
+            indx_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xE2: // sep imm8
+            imm8_m8x8();
+            sep_m8x8();
+            clockticks6502 += 3;
+            break;
+        case 0xE3: // sbc sr
+            sr_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0xE4: // cpx zp
+            penaltyd = 0;
+            zp_m8x8();
+            cpx_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xE5: // sbc zp
+            penaltyd = 0;
+            zp_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 3 + penaltyd;
+            break;
+        case 0xE6: // inc zp
+            penaltyd = 0;
+            zp_m8x8();
+            inc_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xE7: // sbc indl0
+            penaltyd = 0;
+            indl0_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xE8: // inx imp
+            imp_m8x8();
+            inx_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xE9: // sbc immm
+            immm_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xEA: // nop imp
+            imp_m8x8();
+            nop_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xEB: // xba imp
+            imp_m8x8();
+            xba_m8x8();
+            clockticks6502 += 3;
+            break;
+        case 0xEC: // cpx abso
+            abso_m8x8();
+            cpx_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0xED: // sbc abso
+            abso_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0xEE: // inc abso
+            abso_m8x8();
+            inc_m8x8();
+            clockticks6502 += 6;
+            break;
+        case 0xEF: // sbc absl
+            absl_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0xF0: // beq rel
+            rel_m8x8();
+            beq_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xF1: // sbc indy
+            penaltyaddr = 0;
+            penaltyd = 0;
+            indy_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 5 + penaltyaddr + penaltyd;
+            break;
+        case 0xF2: // sbc ind0
+            penaltyd = 0;
+            ind0_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 5 + penaltyd;
+            break;
+        case 0xF3: // sbc sridy
+            penaltyaddr = 0;
+            sridy_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 7 + penaltyaddr;
+            break;
+        case 0xF4: // pea imm16
+            imm16_m8x8();
+            pea_m8x8();
+            clockticks6502 += 5;
+            break;
+        case 0xF5: // sbc zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 4 + penaltyd;
+            break;
+        case 0xF6: // inc zpx
+            penaltyd = 0;
+            zpx_m8x8();
+            inc_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xF7: // sbc indly
+            penaltyd = 0;
+            indly_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 6 + penaltyd;
+            break;
+        case 0xF8: // sed imp
+            imp_m8x8();
+            sed_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xF9: // sbc absy
+            penaltyaddr = 0;
+            absy_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xFA: // plx imp
+            imp_m8x8();
+            plx_m8x8();
+            clockticks6502 += 4;
+            break;
+        case 0xFB: // xce imp
+            imp_m8x8();
+            xce_m8x8();
+            clockticks6502 += 2;
+            break;
+        case 0xFC: // jsr ainx
+            ainx_m8x8();
+            jsr_m8x8();
+            clockticks6502 += 8;
+            break;
+        case 0xFD: // sbc absx
+            penaltyaddr = 0;
+            absx_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 4 + penaltyaddr;
+            break;
+        case 0xFE: // inc absx
+            absx_m8x8();
+            inc_m8x8();
+            clockticks6502 += 7;
+            break;
+        case 0xFF: // sbc abslx
+            penaltyaddr = 0;
+            abslx_m8x8();
+            sbc_m8x8();
+            clockticks6502 += 5 + penaltyaddr;
+            break;
+    }
+}
+
+static const uint8_t oplength_c816_m8x8[256] = {
+    /* 0 */ 0x81, 0x02, 0x81, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 1 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 2 */ 0x83, 0x02, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02, 0x81, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 3 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 4 */ 0x81, 0x02, 0x02, 0x02, 0x83, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x83, 0x03, 0x03, 0x04,
+    /* 5 */ 0x82, 0x02, 0x02, 0x02, 0x83, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x84, 0x03, 0x03, 0x04,
+    /* 6 */ 0x81, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04,
+    /* 7 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x83, 0x03, 0x03, 0x04,
+    /* 8 */ 0x82, 0x02, 0x83, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* 9 */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* A */ 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* B */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* C */ 0x02, 0x02, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x81, 0x03, 0x03, 0x03, 0x04,
+    /* D */ 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04,
+    /* E */ 0x02, 0x02, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04,
+    /* F */ 0x82, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x81, 0x83, 0x03, 0x03, 0x04
 };
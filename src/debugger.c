@@ -521,6 +521,7 @@ static void DEBUGExecCmd() {
 						addr &= 0xFFFFFF;
 						--size;
 					} while (size > 0);
+					memory_invalidate_code();
 				} else {
 					addr &= 0x1FFFF;
 					do {
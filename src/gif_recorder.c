@@ -0,0 +1,399 @@
+// Commander X16 Emulator
+// Copyright (c) 2019 Michael Steil
+// All rights reserved. License: 2-clause BSD
+
+// VERA never shows more than 256 colors at a time, so the frames are
+// written as the color indices they are drawn with, without building a
+// palette for them. A frame only covers the rectangle that has changed
+// since the one before, and it only comes with its own color table if its
+// palette isn't the one of the first frame. Frames that show more than one
+// palette are indexed by their colors instead, and only quantized if they
+// have more than 256 of them.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gif_recorder.h"
+#include "gif.h"
+
+#define LZW_MIN_CODE_SIZE 8
+#define LZW_CLEAR_CODE    (1 << LZW_MIN_CODE_SIZE)
+#define LZW_MAX_CODE      4095
+#define LZW_HASH_BITS     13
+#define LZW_HASH_MASK     ((1 << LZW_HASH_BITS) - 1)
+
+static FILE *gif_file;
+static uint16_t gif_width;
+static uint16_t gif_height;
+static bool gif_header_written;
+static bool gif_first_frame;
+static uint32_t global_palette[256];
+
+// the frame before, to find what has changed
+static uint8_t *prev_indices;
+static uint32_t prev_palette[256];
+
+// a frame given as colors
+static uint8_t *rgb_indices;
+static uint32_t rgb_palette[256];
+static uint8_t *quantized; // in the RGBA layout of gif.h
+
+// The LZW dictionary, from the code of a string and the index that follows
+// it to the code of the longer string.
+static uint32_t lzw_keys[1 << LZW_HASH_BITS]; // 0 if unused
+static uint16_t lzw_codes[1 << LZW_HASH_BITS];
+
+// the codes go out in data sub-blocks of up to 255 bytes
+typedef struct {
+	uint32_t bits;
+	int      num_bits;
+	uint8_t  block[256];
+	int      length;
+} bit_writer_t;
+
+static void
+flush_block(bit_writer_t *w)
+{
+	if (w->length) {
+		w->block[0] = w->length;
+		fwrite(w->block, 1, w->length + 1, gif_file);
+		w->length = 0;
+	}
+}
+
+static void
+write_code(bit_writer_t *w, uint32_t code, int code_size)
+{
+	w->bits |= code << w->num_bits;
+	w->num_bits += code_size;
+	while (w->num_bits >= 8) {
+		w->block[++w->length] = w->bits & 0xff;
+		w->bits >>= 8;
+		w->num_bits -= 8;
+		if (w->length == 255) {
+			flush_block(w);
+		}
+	}
+}
+
+static void
+write_palette(const uint32_t *palette)
+{
+	uint8_t table[256 * 3];
+	for (int i = 0; i < 256; i++) {
+		table[i * 3 + 0] = palette[i] >> 16;
+		table[i * 3 + 1] = palette[i] >> 8;
+		table[i * 3 + 2] = palette[i];
+	}
+	fwrite(table, 1, sizeof(table), gif_file);
+}
+
+static void
+write_header(const uint32_t *palette)
+{
+	fputs("GIF89a", gif_file);
+
+	// screen descriptor with a global color table of 256 entries
+	fputc(gif_width & 0xff, gif_file);
+	fputc(gif_width >> 8, gif_file);
+	fputc(gif_height & 0xff, gif_file);
+	fputc(gif_height >> 8, gif_file);
+	fputc(0xf7, gif_file);
+	fputc(0, gif_file); // background color
+	fputc(0, gif_file); // square pixels
+	write_palette(palette);
+	memcpy(global_palette, palette, sizeof(global_palette));
+
+	// loop forever
+	fputc(0x21, gif_file);
+	fputc(0xff, gif_file);
+	fputc(11, gif_file);
+	fputs("NETSCAPE2.0", gif_file);
+	fputc(3, gif_file);
+	fputc(1, gif_file);
+	fputc(0, gif_file);
+	fputc(0, gif_file);
+	fputc(0, gif_file);
+
+	gif_header_written = true;
+}
+
+static void
+write_lzw(const uint8_t *indices, uint16_t left, uint16_t top, uint16_t width, uint16_t height)
+{
+	bit_writer_t w = { 0 };
+	int code_size = LZW_MIN_CODE_SIZE + 1;
+	uint32_t max_code = LZW_CLEAR_CODE + 1;
+	int32_t prefix = -1;
+
+	fputc(LZW_MIN_CODE_SIZE, gif_file);
+	memset(lzw_keys, 0, sizeof(lzw_keys));
+	write_code(&w, LZW_CLEAR_CODE, code_size);
+
+	for (uint16_t y = top; y < top + height; y++) {
+		const uint8_t *row = &indices[y * gif_width];
+		for (uint16_t x = left; x < left + width; x++) {
+			const uint8_t index = row[x];
+			if (prefix < 0) {
+				prefix = index;
+				continue;
+			}
+
+			const uint32_t key = ((uint32_t)prefix << 8 | index) + 1;
+			uint32_t slot = (key * 2654435761u) >> (32 - LZW_HASH_BITS);
+			while (lzw_keys[slot] && lzw_keys[slot] != key) {
+				slot = (slot + 1) & LZW_HASH_MASK;
+			}
+			if (lzw_keys[slot]) {
+				prefix = lzw_codes[slot];
+				continue;
+			}
+
+			write_code(&w, prefix, code_size);
+			lzw_keys[slot] = key;
+			lzw_codes[slot] = ++max_code;
+			if (max_code >= (1u << code_size)) {
+				code_size++;
+			}
+			if (max_code == LZW_MAX_CODE) {
+				write_code(&w, LZW_CLEAR_CODE, code_size);
+				memset(lzw_keys, 0, sizeof(lzw_keys));
+				code_size = LZW_MIN_CODE_SIZE + 1;
+				max_code = LZW_CLEAR_CODE + 1;
+			}
+			prefix = index;
+		}
+	}
+
+	write_code(&w, prefix, code_size);
+	// the decoder adds a code for the last one as well
+	if (max_code + 1 >= (1u << code_size) && code_size < 12) {
+		code_size++;
+	}
+	write_code(&w, LZW_CLEAR_CODE + 1, code_size);
+	if (w.num_bits) {
+		write_code(&w, 0, 8 - w.num_bits);
+	}
+	flush_block(&w);
+	fputc(0, gif_file); // block terminator
+}
+
+// Finds the rectangle in which the colors differ from the frame before.
+// Returns false if there is none.
+static bool
+changed_rect(const uint8_t *indices, const uint32_t *palette, uint16_t *left, uint16_t *top, uint16_t *right, uint16_t *bottom)
+{
+	const bool same_palette = !memcmp(palette, prev_palette, sizeof(prev_palette));
+
+	*left = gif_width;
+	*right = 0;
+	*top = gif_height;
+	*bottom = 0;
+	for (uint16_t y = 0; y < gif_height; y++) {
+		const uint8_t *row = &indices[y * gif_width];
+		const uint8_t *prev_row = &prev_indices[y * gif_width];
+		if (same_palette && !memcmp(row, prev_row, gif_width)) {
+			continue;
+		}
+		uint16_t x = 0;
+		while (x < gif_width && palette[row[x]] == prev_palette[prev_row[x]]) {
+			x++;
+		}
+		if (x == gif_width) {
+			continue;
+		}
+		uint16_t end = gif_width;
+		while (palette[row[end - 1]] == prev_palette[prev_row[end - 1]]) {
+			end--;
+		}
+		*left = x < *left ? x : *left;
+		*right = end > *right ? end : *right;
+		*top = y < *top ? y : *top;
+		*bottom = y + 1;
+	}
+	return *top < *bottom;
+}
+
+bool
+gif_recorder_begin(const char *path, uint16_t width, uint16_t height)
+{
+	gif_file = fopen(path, "wb");
+	if (!gif_file) {
+		return false;
+	}
+	gif_width = width;
+	gif_height = height;
+	gif_header_written = false;
+	gif_first_frame = true;
+	memset(prev_palette, 0, sizeof(prev_palette));
+	prev_indices = malloc(width * height);
+	rgb_indices = malloc(width * height);
+	quantized = malloc(width * height * 4);
+	return true;
+}
+
+bool
+gif_recorder_add_indexed(const uint8_t *indices, const uint32_t *palette, uint16_t delay)
+{
+	if (!gif_file) {
+		return false;
+	}
+
+	uint16_t left = 0;
+	uint16_t top = 0;
+	uint16_t right = gif_width;
+	uint16_t bottom = gif_height;
+	if (!gif_header_written) {
+		write_header(palette);
+	}
+	if (gif_first_frame) {
+		gif_first_frame = false;
+	} else if (!changed_rect(indices, palette, &left, &top, &right, &bottom)) {
+		// a single unchanged pixel holds the delay
+		left = top = 0;
+		right = bottom = 1;
+	}
+	const bool local_palette = memcmp(palette, global_palette, sizeof(global_palette)) != 0;
+
+	// graphics control extension: leave the frame in place
+	fputc(0x21, gif_file);
+	fputc(0xf9, gif_file);
+	fputc(4, gif_file);
+	fputc(0x04, gif_file);
+	fputc(delay & 0xff, gif_file);
+	fputc(delay >> 8, gif_file);
+	fputc(0, gif_file); // transparent color index, unused
+	fputc(0, gif_file);
+
+	// image descriptor
+	fputc(0x2c, gif_file);
+	fputc(left & 0xff, gif_file);
+	fputc(left >> 8, gif_file);
+	fputc(top & 0xff, gif_file);
+	fputc(top >> 8, gif_file);
+	fputc((right - left) & 0xff, gif_file);
+	fputc((right - left) >> 8, gif_file);
+	fputc((bottom - top) & 0xff, gif_file);
+	fputc((bottom - top) >> 8, gif_file);
+	if (local_palette) {
+		fputc(0x87, gif_file);
+		write_palette(palette);
+	} else {
+		fputc(0, gif_file);
+	}
+	write_lzw(indices, left, top, right - left, bottom - top);
+
+	memcpy(prev_indices, indices, gif_width * gif_height);
+	memcpy(prev_palette, palette, sizeof(prev_palette));
+	return !ferror(gif_file);
+}
+
+// open addressing by color, for the colors of the given palette and the new
+// ones of a frame
+static uint32_t color_keys[1024]; // the color plus one, 0 if unused
+static uint16_t color_values[1024];
+
+static uint16_t *
+color_value(uint32_t color)
+{
+	const uint32_t key = (color & 0xffffff) + 1;
+	uint32_t slot = (key * 2654435761u) >> 22;
+	while (color_keys[slot] && color_keys[slot] != key) {
+		slot = (slot + 1) & 1023;
+	}
+	if (!color_keys[slot]) {
+		color_keys[slot] = key;
+		color_values[slot] = UINT16_MAX;
+	}
+	return &color_values[slot];
+}
+
+// The colors of a frame get indices into a table of them, as long as there
+// are no more than 256. The colors that are in the given palette keep their
+// index there, so that the table mostly comes out as that palette.
+static bool
+index_colors(const uint32_t *pixels, const uint32_t *palette)
+{
+	bool used[256] = { false };
+	uint32_t new_colors[256];
+	int num_new_colors = 0;
+
+	memset(color_keys, 0, sizeof(color_keys));
+	memcpy(rgb_palette, palette, sizeof(rgb_palette));
+	for (int i = 255; i >= 0; i--) {
+		*color_value(palette[i]) = i;
+	}
+	for (int i = 0; i < gif_width * gif_height; i++) {
+		uint16_t *value = color_value(pixels[i]);
+		if (*value < 256) {
+			used[*value] = true;
+		} else if (*value == UINT16_MAX) {
+			if (num_new_colors == 256) {
+				return false;
+			}
+			*value = 256 + num_new_colors;
+			new_colors[num_new_colors++] = pixels[i] & 0xffffff;
+		}
+	}
+
+	// the new colors take the entries of the ones that aren't shown
+	int index = 0;
+	for (int i = 0; i < num_new_colors; i++) {
+		while (index < 256 && used[index]) {
+			index++;
+		}
+		if (index == 256) {
+			return false;
+		}
+		rgb_palette[index] = new_colors[i];
+		*color_value(new_colors[i]) = index++;
+	}
+	for (int i = 0; i < gif_width * gif_height; i++) {
+		rgb_indices[i] = *color_value(pixels[i]);
+	}
+	return true;
+}
+
+bool
+gif_recorder_add_rgb(const uint32_t *pixels, const uint32_t *palette, uint16_t delay)
+{
+	if (!gif_file) {
+		return false;
+	}
+	if (!gif_header_written) {
+		// rather than the colors of a frame that isn't all drawn yet
+		write_header(palette);
+	}
+
+	if (!index_colors(pixels, palette)) {
+		// gif.h takes the bytes as RGBA, so its red is blue
+		GifPalette pal;
+		GifMakePalette(NULL, (const uint8_t *)pixels, gif_width, gif_height, 8, false, &pal);
+		GifThresholdImage(NULL, (const uint8_t *)pixels, quantized, gif_width, gif_height, &pal);
+		for (int i = 1; i < 256; i++) {
+			rgb_palette[i] = (uint32_t)pal.b[i] << 16 | (uint32_t)pal.g[i] << 8 | pal.r[i];
+		}
+		for (int i = 0; i < gif_width * gif_height; i++) {
+			rgb_indices[i] = quantized[i * 4 + 3];
+		}
+	}
+	return gif_recorder_add_indexed(rgb_indices, rgb_palette, delay);
+}
+
+void
+gif_recorder_end()
+{
+	if (!gif_file) {
+		return;
+	}
+	if (!gif_header_written) {
+		static const uint32_t black[256];
+		write_header(black);
+	}
+	fputc(0x3b, gif_file); // trailer
+	fclose(gif_file);
+	gif_file = NULL;
+	free(prev_indices);
+	free(rgb_indices);
+	free(quantized);
+}
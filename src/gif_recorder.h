@@ -0,0 +1,18 @@
+// Commander X16 Emulator
+// Copyright (c) 2019 Michael Steil
+// All rights reserved. License: 2-clause BSD
+
+#ifndef _GIF_RECORDER_H_
+#define _GIF_RECORDER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The colors are 0x00RRGGBB, the delay is in hundredths of a second. A
+// frame of colors is indexed by the palette it mostly shows where it can.
+bool gif_recorder_begin(const char *path, uint16_t width, uint16_t height);
+bool gif_recorder_add_indexed(const uint8_t *indices, const uint32_t *palette, uint16_t delay);
+bool gif_recorder_add_rgb(const uint32_t *pixels, const uint32_t *palette, uint16_t delay);
+void gif_recorder_end();
+
+#endif
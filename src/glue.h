@@ -10,6 +10,7 @@
 #include <SDL.h>
 
 #include "cpu/registers.h"
+#include "machine.h"
 
 //#define TRACE
 //#define PERFSTAT
@@ -54,10 +55,10 @@ typedef enum {
 	RECORD_GIF_ACTIVE
 } gif_recorder_state_t;
 
-extern struct regs regs;
-extern uint16_t opcode_addr;
-extern uint8_t *RAM;
-extern uint8_t *BRAM;
+extern machine_local struct regs regs;
+extern machine_local uint16_t opcode_addr;
+extern machine_local uint8_t *RAM;
+extern machine_local uint8_t *BRAM;
 extern uint8_t ROM[];
 extern uint8_t *CART;
 
@@ -77,17 +78,26 @@ extern uint8_t *fsroot_path;
 extern uint8_t *startin_path;
 extern uint8_t keymap;
 extern bool warp_mode;
+extern bool rewinding;
 extern bool grab_mouse;
 extern bool testbench;
+extern machine_local bool headless;
 extern bool has_via2;
+extern bool has_serial;
+extern bool set_system_time;
+extern bool ym2151_irq_support;
+extern bool block_cache;
 extern uint32_t host_sample_rate;
 extern bool enable_midline;
+extern int render_threads;
 
 extern bool has_midi_card;
 extern uint16_t midi_card_addr;
 
 extern void machine_dump(const char* reason);
 extern void machine_reset();
+extern void machine_save_state();
+extern void machine_load_state();
 extern void machine_nmi();
 extern void machine_paste(char *text, bool handle_free);
 extern void machine_toggle_warp();
@@ -100,9 +110,9 @@ extern bool video_is_special_address(int addr);
 
 extern int ieee_unit;
 extern bool using_hostfs;
-extern uint8_t activity_led;
-extern bool nvram_dirty;
-extern uint8_t nvram[0x40];
+extern machine_local uint8_t activity_led;
+extern machine_local bool nvram_dirty;
+extern machine_local uint8_t nvram[0x40];
 
 extern uint8_t MHZ;
 
@@ -7,6 +7,7 @@
 #include "i2c.h"
 #include "smc.h"
 #include "rtc.h"
+#include "savestate.h"
 
 #define LOG_LEVEL 0
 
@@ -16,19 +17,20 @@
 #define STATE_START 0
 #define STATE_STOP -1
 
-i2c_port_t i2c_port;
+machine_local i2c_port_t i2c_port;
+static machine_local i2c_port_t old_i2c_port;
 
-static int state = STATE_STOP;
-static bool read_mode = false;
-static uint8_t value = 0;
-static int count = 0;
-static uint8_t device;
+static machine_local int state = STATE_STOP;
+static machine_local bool read_mode = false;
+static machine_local uint8_t value = 0;
+static machine_local int count = 0;
+static machine_local uint8_t device;
 
 #define KBD_SIZE 16
-uint8_t kbd_buffer[KBD_SIZE];						//Ring buffer for key codes
+machine_local uint8_t kbd_buffer[KBD_SIZE];						//Ring buffer for key codes
 
 #define MSE_SIZE 16
-uint8_t mse_buffer[MSE_SIZE];						//Ring buffer for mouse movement data
+machine_local uint8_t mse_buffer[MSE_SIZE];						//Ring buffer for mouse movement data
 
 void i2c_reset_state() {
 	state = STATE_STOP;
@@ -97,8 +99,6 @@ i2c_write(uint8_t device) {
 void
 i2c_step()
 {
-	static i2c_port_t old_i2c_port;
-
 	if (old_i2c_port.clk_in != i2c_port.clk_in || old_i2c_port.data_in != i2c_port.data_in) {
 #if LOG_LEVEL >= 5
 		printf("I2C(%d) C:%d D:%d\n", state, i2c_port.clk_in, i2c_port.data_in);
@@ -197,8 +197,8 @@ i2c_step()
 /**
  * Keyboard buffer functions
  **/
-uint8_t kbd_head=0;
-uint8_t kbd_tail=0;
+machine_local uint8_t kbd_head=0;
+machine_local uint8_t kbd_tail=0;
 
 /**
  * Adds value to the keyboard ring buffer; the value is discarded if the buffer is full
@@ -233,8 +233,8 @@ void i2c_kbd_buffer_flush() {
 /**
  * Mouse buffer functions
  **/
-uint8_t mse_head=0;
-uint8_t mse_tail=0;
+machine_local uint8_t mse_head=0;
+machine_local uint8_t mse_tail=0;
 
 /**
  * Adds value to the mouse ring buffer; discards the value if the buffer is full
@@ -278,11 +278,11 @@ uint8_t i2c_mse_buffer_count() {
  *  fake mouse
  **/
 
-static uint8_t buttons;
-static int16_t mouse_diff_x = 0;
-static int16_t mouse_diff_y = 0;
-static int8_t wheel = 0;
-static uint8_t mouse_device_id = 3;
+static machine_local uint8_t buttons;
+static machine_local int16_t mouse_diff_x = 0;
+static machine_local int16_t mouse_diff_y = 0;
+static machine_local int8_t wheel = 0;
+static machine_local uint8_t mouse_device_id = 3;
 
 // byte 0, bit 7: Y overflow
 // byte 0, bit 6: X overflow
@@ -403,3 +403,26 @@ mouse_set_device_id(uint8_t d) {
 	}
 	i2c_mse_buffer_flush();
 }
+
+void
+i2c_state(state_t *s)
+{
+	STATE(s, i2c_port);
+	STATE(s, old_i2c_port);
+	STATE(s, state);
+	STATE(s, read_mode);
+	STATE(s, value);
+	STATE(s, count);
+	STATE(s, device);
+	STATE(s, kbd_buffer);
+	STATE(s, kbd_head);
+	STATE(s, kbd_tail);
+	STATE(s, mse_buffer);
+	STATE(s, mse_head);
+	STATE(s, mse_tail);
+	STATE(s, buttons);
+	STATE(s, mouse_diff_x);
+	STATE(s, mouse_diff_y);
+	STATE(s, wheel);
+	STATE(s, mouse_device_id);
+}
@@ -6,6 +6,7 @@
 #define _I2C_H_
 
 #include <stdint.h>
+#include "machine.h"
 
 #define I2C_DATA_MASK 1
 #define I2C_CLK_MASK 2
@@ -16,7 +17,7 @@ typedef struct {
 	int data_out;
 } i2c_port_t;
 
-extern i2c_port_t i2c_port;
+extern machine_local i2c_port_t i2c_port;
 
 void i2c_reset_state();
 void i2c_step();
@@ -0,0 +1,285 @@
+// Commander X16 Emulator
+// Copyright (c) 2019 Michael Steil
+// All rights reserved. License: 2-clause BSD
+
+// The machine: CPU, memory and the devices on the bus, stepped by the
+// scheduler. x16emu creates one on the main thread, with the host devices
+// (IEC serial to the host filesystem, MIDI card, audio output) attached.
+// Programs linking the emulator can create more, headless ones, one per
+// thread, which share the ROM image but nothing else.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "machine.h"
+#include "glue.h"
+#include "cpu/fake6502.h"
+#include "memory.h"
+#include "video.h"
+#include "via.h"
+#include "serial.h"
+#include "i2c.h"
+#include "rtc.h"
+#include "vera_spi.h"
+#include "audio.h"
+#include "ymglue.h"
+#include "midi.h"
+#include "scheduler.h"
+
+struct machine {
+	SDL_threadID thread;
+};
+
+static machine_local struct machine *current; // created by machine_create()
+static machine_local bool host_devices;
+static machine_local bool irq_out;
+machine_local bool new_frame;
+
+//
+// devices stepped by the scheduler
+//
+
+static void
+vera_spi_device_step(unsigned clocks)
+{
+	vera_spi_step(MHZ, clocks);
+}
+
+static void
+serial_device_step(unsigned clocks)
+{
+	serial_step(clocks);
+}
+
+static void
+video_device_step(unsigned clocks)
+{
+	new_frame |= video_step(MHZ, clocks, false);
+}
+
+static uint32_t
+video_device_next_event()
+{
+	return video_next_event(MHZ);
+}
+
+static void
+i2c_device_step(unsigned clocks)
+{
+	i2c_step(); // only reacts to changes of the port lines
+}
+
+static void
+rtc_device_step(unsigned clocks)
+{
+	rtc_step(clocks);
+}
+
+static void
+audio_device_step(unsigned clocks)
+{
+	audio_step(clocks);
+}
+
+static uint32_t
+audio_device_next_event()
+{
+	return audio_next_event();
+}
+
+static void
+midi_device_step(unsigned clocks)
+{
+	midi_serial_step(clocks);
+}
+
+static void
+ym2151_irq_device_step(unsigned clocks)
+{
+	audio_render();
+}
+
+static uint32_t
+every_instruction()
+{
+	return SCHEDULER_EVERY_INSTRUCTION;
+}
+
+static void
+register_devices()
+{
+	scheduler_init();
+	scheduler_add_device(via1_step, via1_next_event);
+	scheduler_add_device(vera_spi_device_step, NULL);
+	if (has_serial && host_devices) {
+		// bit level IEC timing, no event prediction
+		scheduler_add_device(serial_device_step, every_instruction);
+	}
+	if (has_via2) {
+		scheduler_add_device(via2_step, via2_next_event);
+	}
+	// also headless: the beam position drives the VSYNC, LINE and sprite
+	// collision IRQs, only the pixel output is skipped
+	scheduler_add_device(video_device_step, video_device_next_event);
+	scheduler_add_device(i2c_device_step, NULL);
+	scheduler_add_device(rtc_device_step, NULL);
+	if (!headless) {
+		scheduler_add_device(audio_device_step, audio_device_next_event);
+	}
+	if (host_devices) {
+		scheduler_add_device(midi_device_step, midi_serial_next_event);
+	}
+	// The optimization from the opportunistic batching of audio rendering
+	// is lost if we need to track the YM2151 IRQ, so it has been made a
+	// command-line switch that's disabled by default.
+	if (ym2151_irq_support && host_devices) {
+		scheduler_add_device(ym2151_irq_device_step, every_instruction);
+	}
+}
+
+static void
+init(bool host)
+{
+	host_devices = host;
+	irq_out = false;
+	new_frame = false;
+	memory_init();
+	register_devices();
+}
+
+// reset the emulated hardware, machine_reset() adds the host side
+void
+machine_reset_hardware()
+{
+	i2c_reset_state();
+	memory_reset();
+	vera_spi_init();
+	via1_init();
+	if (has_via2) {
+		via2_init();
+	}
+	video_reset();
+	reset6502(regs.is65c816);
+	scheduler_expire();
+}
+
+static void
+update_irq_out()
+{
+	irq_out = video_get_irq_out() || via1_irq() || (has_via2 && via2_irq()) || (ym2151_irq_support && YM_irq()) || (host_devices && has_midi_card && midi_serial_irq());
+}
+
+// Execute one instruction, or one decoded block with -blockcache, and bring
+// the devices up to date if one of them has an event due. Returns the number
+// of instructions executed.
+uint32_t
+machine_execute()
+{
+	uint32_t count;
+
+	if (waiting && !debugger_enabled && !scheduler_due()) {
+		// Only an interrupt ends WAI, and no device can raise one
+		// before its next event: skip the idle clocks up to it.
+		clockticks6502 = scheduler_deadline - 1;
+	}
+
+	if (block_cache && !debugger_enabled) {
+		count = stepblock6502();
+	} else {
+		count = waiting ^ 0x1;
+
+		step6502();
+	}
+
+	// devices only change their IRQ outputs at their events or on I/O
+	// accesses, both make the scheduler due
+	if (debugger_enabled || scheduler_due()) {
+		scheduler_sync();
+		update_irq_out();
+	}
+	return count;
+}
+
+// bring the machine back in line after its state has been replaced
+void
+machine_sync()
+{
+	scheduler_expire();
+	scheduler_sync();
+	update_irq_out();
+}
+
+bool
+machine_irq_out()
+{
+	return irq_out;
+}
+
+bool
+machine_is_host()
+{
+	return host_devices;
+}
+
+struct machine *
+machine_create(bool c816, bool host)
+{
+	if (current) {
+#ifdef MACHINE_LOCAL_PER_THREAD
+		printf("There already is a machine on this thread!\n");
+#else
+		printf("There can only be one machine on this platform!\n");
+#endif
+		return NULL;
+	}
+	struct machine *m = malloc(sizeof(struct machine));
+	if (!m || !video_create()) {
+		printf("Cannot allocate the machine!\n");
+		free(m);
+		return NULL;
+	}
+	m->thread = SDL_ThreadID();
+	current = m;
+
+	regs.is65c816 = c816;
+	if (host) {
+		init(true);
+		rtc_init(set_system_time);
+		return m;
+	}
+	headless = true;
+	init(false);
+	rtc_init(false);
+	machine_reset_hardware();
+	return m;
+}
+
+bool
+machine_step(struct machine *m, uint32_t clocks, uint32_t *clocks_run)
+{
+	if (m != current || m->thread != SDL_ThreadID()) {
+		return false;
+	}
+	uint32_t start = clockticks6502;
+	while (clockticks6502 - start < clocks && regs.pc != 0xffff) {
+		machine_execute();
+		if (irq_out) {
+			irq6502();
+		}
+	}
+	*clocks_run = clockticks6502 - start;
+	return true;
+}
+
+bool
+machine_destroy(struct machine *m)
+{
+	if (m != current || m->thread != SDL_ThreadID()) {
+		return false;
+	}
+	memory_shutdown();
+	freeblocks6502();
+	video_destroy();
+	current = NULL;
+	free(m);
+	return true;
+}
@@ -0,0 +1,53 @@
+// Commander X16 Emulator
+// Copyright (c) 2019 Michael Steil
+// All rights reserved. License: 2-clause BSD
+
+#ifndef _MACHINE_H_
+#define _MACHINE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The state of the emulated hardware (CPU, memory, VERA, VIAs, SMC, ...)
+// is declared machine_local: every thread owns the state of one machine.
+// The options, the ROM and cartridge images and the host side (window,
+// audio output, MIDI, host filesystem) are shared by all machines of the
+// process.
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+#define machine_local // one machine per process
+#elif defined(__cplusplus)
+#define machine_local thread_local
+#define MACHINE_LOCAL_PER_THREAD
+#else
+#define machine_local _Thread_local
+#define MACHINE_LOCAL_PER_THREAD
+#endif
+
+struct machine;
+
+// Create a machine on the calling thread. It can only be used from this
+// thread, and there is one machine per thread, or only one at all where the
+// machine state isn't per thread (Windows, Emscripten): returns NULL if
+// there already is one, or if its memory can't be allocated. The ROM has to
+// be loaded before a headless machine is created.
+// A headless machine is reset right away. x16emu's own machine gets the
+// host devices, and its machine_reset() adds the host side and resets it.
+struct machine *machine_create(bool c816, bool host);
+// Run the machine for at least the given number of clocks, or until the
+// CPU reaches $FFFF, and store the number of clocks run. Returns false if
+// the machine isn't the one of the calling thread.
+bool machine_step(struct machine *m, uint32_t clocks, uint32_t *clocks_run);
+// Returns false if the machine isn't the one of the calling thread.
+bool machine_destroy(struct machine *m);
+
+// x16emu's own machine on the main thread
+void machine_reset_hardware();
+uint32_t machine_execute();
+void machine_sync();
+bool machine_irq_out();
+// whether the calling thread's machine is x16emu's own, with the host side
+bool machine_is_host();
+
+extern machine_local bool new_frame;
+
+#endif
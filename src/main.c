@@ -13,6 +13,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <limits.h>
+#include <inttypes.h>
 #ifdef __MINGW32__
 #include <ctype.h>
 #endif
@@ -40,9 +41,14 @@
 #include "audio.h"
 #include "version.h"
 #include "wav_recorder.h"
+#include "recorder.h"
 #include "testbench.h"
 #include "cartridge.h"
 #include "midi.h"
+#include "scheduler.h"
+#include "machine.h"
+#include "savestate.h"
+#include "rewind.h"
 #include "git_rev.h"
 
 #ifdef __EMSCRIPTEN__
@@ -52,6 +58,7 @@
 
 void *emulator_loop(void *param);
 void emscripten_main_loop(void);
+static void basic_input_poll();
 
 // This must match the KERNAL's set!
 char *keymaps[] = {
@@ -126,11 +133,13 @@ float screen_x_scale = 1.0;
 float window_opacity = 1.0;
 char *scale_quality = "best";
 bool test_init_complete=false;
-bool headless = false;
+machine_local bool headless = false;
 bool fullscreen = false;
 bool testbench = false;
 bool enable_midline = false;
+int render_threads = 0;
 bool ym2151_irq_support = false;
+bool block_cache = false;
 char *cartridge_path = NULL;
 
 bool has_midi_card = false;
@@ -151,7 +160,18 @@ bool prg_finished_loading;
 int prg_override_start = -1;
 bool run_after_load = false;
 
+struct machine *machine;
+
 char *nvram_path = NULL;
+char *state_path = "state.bin";
+bool load_state = false;
+
+int rewind_seconds = 0;
+bool rewinding = false;
+
+char *boot_cache_dir = NULL;
+char boot_cache_path[PATH_MAX];
+bool boot_cache_pending = false;
 
 bool pwr_long_press=false;
 bool is_gen2 = false;
@@ -328,18 +348,25 @@ void mouse_state_init(void)
 void
 machine_reset()
 {
-	i2c_reset_state();
 	ieee_init();
-	memory_reset();
-	vera_spi_init();
-	via1_init();
-	if (has_via2) {
-		via2_init();
-	}
-	video_reset();
 	mouse_state_init();
-	reset6502(regs.is65c816);
 	midi_serial_init();
+	machine_reset_hardware();
+}
+
+void
+machine_save_state()
+{
+	savestate_save(state_path, false);
+}
+
+void
+machine_load_state()
+{
+	if (savestate_load(state_path, false)) {
+		// the CPU clock jumped
+		timing_init();
+	}
 }
 
 void
@@ -401,6 +428,17 @@ usage()
 	printf("-nvram <nvram.bin>\n");
 	printf("\tSpecify NVRAM image. By default, the machine starts with\n");
 	printf("\tempty NVRAM and does not save it to disk.\n");
+	printf("-state <state.bin>\n");
+	printf("\tLoad a save state at startup. Ctrl+F5 saves the machine\n");
+	printf("\tstate to this file, Ctrl+F9 loads it again.\n");
+	printf("\tThe default file is state.bin.\n");
+	printf("-bootcache <directory>\n");
+	printf("\tKeep the state of the machine after booting in this directory\n");
+	printf("\tand start from it if ROM, NVRAM and machine options match.\n");
+	printf("-rewind <seconds>\n");
+	printf("\tKeep the given number of seconds of history, as far as\n");
+	printf("\t64 MB of memory changes go. Holding Ctrl+Z runs the\n");
+	printf("\tmachine backwards.\n");
 	printf("-keymap <keymap>\n");
 	printf("\tEnable a specific keyboard layout decode table.\n");
 	printf("-sdcard <sdcard.img>\n");
@@ -524,9 +562,17 @@ usage()
 	printf("-midline-effects\n");
 	printf("\tApproximate mid-line raster effects when changing tile, sprite,\n");
 	printf("\tand palette data. Requires a fast host CPU.\n");
+	printf("-render-threads <n>\n");
+	printf("\tDraw the screen on threads of their own. A single thread draws\n");
+	printf("\tnext to the emulation, more draw bands of the frame in parallel\n");
+	printf("\tat its end. The maximum is %d. Not available on Windows and the web.\n", RENDER_MAX_THREADS);
 	printf("-enable-ym2151-irq\n");
 	printf("\tConnect the YM2151 IRQ source to the emulated CPU. This option increases\n");
 	printf("\tCPU usage as audio render is triggered for every CPU instruction.\n");
+	printf("-blockcache\n");
+	printf("\tExecute CPU code from cached copies of instruction blocks, which\n");
+	printf("\tskips the memory decoding of instruction fetches. IRQs are only\n");
+	printf("\ttaken between blocks. Ignored with the debugger.\n");
 	printf("-c02\n");
 	printf("\tRun the emulator under an emulated 65C02 (default)\n");
 	printf("-c816\n");
@@ -596,6 +642,123 @@ void no_fluidsynth_warning(void)
 	}
 }
 
+static uint64_t
+hash_data(uint64_t hash, const void *data, size_t size)
+{
+	// FNV-1a
+	for (size_t i = 0; i < size; i++) {
+		hash = (hash ^ ((const uint8_t *)data)[i]) * 0x100000001b3;
+	}
+	return hash;
+}
+
+#define HASH(hash, var) hash_data((hash), &(var), sizeof(var))
+#define HASH_STRING(hash, str) hash_data((hash), (str), strlen(str))
+
+// A state saved by a different build of the emulator can resume differently
+// even if it loads, so the build goes into the hash as well. Without a clean
+// git checkout, the revision doesn't tell builds apart, and the time this
+// file was compiled has to do.
+static uint64_t
+hash_build(uint64_t hash)
+{
+	hash = HASH_STRING(hash, VER);
+	hash = HASH_STRING(hash, VER_NAME);
+#ifdef GIT_REV
+	const char *rev = GIT_REV;
+	hash = HASH_STRING(hash, rev);
+	if (rev[strlen(rev) - 1] != '+' && strcmp(rev, "00000000")) {
+		return hash;
+	}
+#endif
+	return HASH_STRING(hash, __DATE__ " " __TIME__);
+}
+
+// Everything that influences the boot up to BASIC's first line input goes
+// into the name of the cache file.
+static uint64_t
+boot_cache_hash(bool zeroram)
+{
+	uint64_t hash = 0xcbf29ce484222325;
+	uint32_t version = SAVESTATE_VERSION;
+
+	hash = HASH(hash, version);
+	hash = hash_build(hash);
+	hash = hash_data(hash, ROM, ROM_SIZE);
+	hash = HASH(hash, nvram);
+	if (CART) {
+		for (int bank = 32; bank < 256; bank++) {
+			uint8_t type = cartridge_get_bank_type(bank);
+			hash = HASH(hash, type);
+		}
+		hash = hash_data(hash, CART, (256 - 32) * 0x4000);
+	}
+	hash = HASH(hash, num_banks);
+	hash = HASH(hash, num_ram_banks);
+	hash = HASH(hash, regs.is65c816);
+	hash = HASH(hash, has_via2);
+	hash = HASH(hash, has_serial);
+	hash = HASH(hash, has_midi_card);
+	hash = HASH(hash, midi_card_addr);
+	hash = HASH(hash, ym2151_irq_support);
+	hash = HASH(hash, enable_midline);
+	hash = HASH(hash, keymap);
+	hash = HASH(hash, MHZ);
+	hash = HASH(hash, pwr_long_press);
+	hash = HASH(hash, using_hostfs);
+	hash = HASH(hash, no_ieee_intercept);
+	hash = HASH(hash, ieee_unit);
+	hash = HASH(hash, zeroram);
+	return hash;
+}
+
+// Resume from the cached boot, or arrange for it to be written at BASIC's
+// first line input. Returns whether the machine has been restored.
+static bool
+boot_cache_open(bool zeroram, bool sdcard)
+{
+	if (sdcard || debugger_enabled) {
+		// the boot depends on more than the configuration
+		return false;
+	}
+	if (using_hostfs) {
+		char autoboot[PATH_MAX];
+		snprintf(autoboot, sizeof(autoboot), "%s/AUTOBOOT.X16", startin_path);
+		if (access(autoboot, F_OK) != -1) {
+			return false;
+		}
+	}
+
+	snprintf(boot_cache_path, sizeof(boot_cache_path), "%s/boot-%016" PRIx64 ".x16state", boot_cache_dir, boot_cache_hash(zeroram));
+	if (access(boot_cache_path, F_OK) == -1) {
+		boot_cache_pending = true;
+		return false;
+	}
+	if (!savestate_load(boot_cache_path, true)) {
+		// stale or damaged, replace it
+		boot_cache_pending = true;
+		machine_reset();
+		return false;
+	}
+	if (set_system_time) {
+		rtc_init(true);
+	}
+	return true;
+}
+
+// Other emulators may be reading the cache or writing it at the same time,
+// so the file only appears once it is complete. If another emulator has
+// already put its copy there, Windows keeps that one, which is just as good.
+static void
+boot_cache_save()
+{
+	char temp_path[PATH_MAX + 32];
+	snprintf(temp_path, sizeof(temp_path), "%s.%d.tmp", boot_cache_path, (int)getpid());
+	if (!savestate_save(temp_path, true) || rename(temp_path, boot_cache_path)) {
+		remove(temp_path);
+	}
+}
+
 int
 main(int argc, char **argv)
 {
@@ -746,6 +909,34 @@ main(int argc, char **argv)
 			nvram_path = argv[0];
 			argc--;
 			argv++;
+		} else if (!strcmp(argv[0], "-state")) {
+			argc--;
+			argv++;
+			if (!argc || argv[0][0] == '-') {
+				usage();
+			}
+			state_path = argv[0];
+			load_state = true;
+			argc--;
+			argv++;
+		} else if (!strcmp(argv[0], "-bootcache")) {
+			argc--;
+			argv++;
+			if (!argc || argv[0][0] == '-') {
+				usage();
+			}
+			boot_cache_dir = argv[0];
+			argc--;
+			argv++;
+		} else if (!strcmp(argv[0], "-rewind")) {
+			argc--;
+			argv++;
+			if (!argc || argv[0][0] == '-') {
+				usage();
+			}
+			rewind_seconds = atoi(argv[0]);
+			argc--;
+			argv++;
 		} else if (!strcmp(argv[0], "-sdcard")) {
 			argc--;
 			argv++;
@@ -1121,10 +1312,26 @@ main(int argc, char **argv)
 			argc--;
 			argv++;
 			enable_midline = true;
+		} else if (!strcmp(argv[0], "-render-threads")){
+			argc--;
+			argv++;
+			if (!argc || argv[0][0] == '-') {
+				usage();
+			}
+			render_threads = (int)strtol(argv[0], NULL, 10);
+			if (render_threads < 1 || render_threads > RENDER_MAX_THREADS) {
+				usage();
+			}
+			argc--;
+			argv++;
 		} else if (!strcmp(argv[0], "-enable-ym2151-irq")){
 			argc--;
 			argv++;
 			ym2151_irq_support = true;
+		} else if (!strcmp(argv[0], "-blockcache")){
+			argc--;
+			argv++;
+			block_cache = true;
 		} else if (!strcmp(argv[0], "-c816")){
 			argc--;
 			argv++;
@@ -1242,6 +1449,12 @@ main(int argc, char **argv)
 		snprintf(paste_text, sizeof(paste_text_data), "TEST %d\r", test_number);
 	}
 
+	// before video_init(), which resets VERA
+	machine = machine_create(regs.is65c816, true);
+	if (!machine) {
+		exit(1);
+	}
+
 #ifdef SDL_HINT_VIDEO_X11_NET_WM_BYPASS_COMPOSITOR
 	// Don't disable compositing (on KDE for example)
 	// Available since SDL 2.0.8
@@ -1274,14 +1487,22 @@ main(int argc, char **argv)
 
 	wav_recorder_set_path(wav_path);
 
-	memory_init();
-
 	joystick_init();
 
-	rtc_init(set_system_time);
-
 	machine_reset();
 
+	if (load_state) {
+		if (!savestate_load(state_path, false)) {
+			exit(1);
+		}
+	} else if (boot_cache_dir && boot_cache_open(zeroram, sdcard_path)) {
+		// the machine waits for BASIC input
+		basic_input_poll();
+	}
+
+	// one capture per frame
+	rewind_init(rewind_seconds * 60);
+
 	timing_init();
 
 	instruction_counter = 0;
@@ -1295,6 +1516,7 @@ main(int argc, char **argv)
 
 	main_shutdown();
 	memory_dump_usage_counts();
+	machine_destroy(machine);
 	return 0;
 }
 
@@ -1303,6 +1525,7 @@ void main_shutdown() {
 		wav_recorder_shutdown();
 		audio_close();
 		video_end();
+		recorder_shutdown();
 		SDL_Quit();
 	}
 	if(cartridge_path) {
@@ -1382,6 +1605,7 @@ set_kernal_status(uint8_t s)
 
 	// everything okay, write the status!
 	RAM[status0] = s;
+	memory_invalidate_code();
 	return true;
 }
 
@@ -1560,6 +1784,7 @@ handle_ieee_intercept()
 		uint64_t perf_diff = SDL_GetPerformanceCounter() - base_ticks;
 		uint32_t missed_ticks = (uint64_t)(perf_diff * 1000000ULL * MHZ) / SDL_GetPerformanceFrequency();
 		clockticks6502 += missed_ticks;
+		update6502mode(); // the handlers above may have changed m/x
 		if (s >= 0) {
 			if (!set_kernal_status(s)) {
 				printf("Warning: Could not set STATUS!\n");
@@ -1574,6 +1799,51 @@ handle_ieee_intercept()
 	return handled;
 }
 
+// as soon as BASIC starts reading a line...
+static void
+basic_input_poll()
+{
+	static bool prg_done = false;
+
+	if (boot_cache_pending) {
+		// the boot is complete and nothing has been pasted yet
+		boot_cache_pending = false;
+		boot_cache_save();
+	}
+
+	if (prg_file && !prg_done) {
+		int loadlen = 0;
+		// LOAD":*" will cause the IEEE library
+		// to load from "prg_file"
+		if (prg_override_start >= 0) {
+			loadlen = snprintf(paste_text_data, sizeof(paste_text_data), "LOAD\":*\",%d,1,$%04X\r", ieee_unit, prg_override_start);
+		} else {
+			loadlen = snprintf(paste_text_data, sizeof(paste_text_data), "LOAD\":*\",%d,1\r", ieee_unit);
+		}
+		paste_text = paste_text_data;
+		prg_done = true;
+
+		if (run_after_load) {
+			if (prg_override_start >= 0) {
+				snprintf(paste_text_data + loadlen, sizeof(paste_text_data) - loadlen, "SYS$%04X\r", prg_override_start);
+			} else {
+				snprintf(paste_text_data + loadlen, sizeof(paste_text_data) - loadlen, "RUN\r");
+			}
+		}
+	}
+	else if (testbench && !test_init_complete){
+		snprintf(paste_text_data, sizeof(paste_text_data), "SYS65533\r");
+		paste_text = paste_text_data;
+		test_init_complete=true;
+	}
+
+	if (paste_text) {
+		// ...paste BASIC code into the keyboard buffer
+		pasting_bas = true;
+		if (warp_pastes) warp_mode = true;
+	}
+}
+
 void
 emscripten_main_loop(void) {
 	emulator_loop(NULL);
@@ -1583,7 +1853,6 @@ emscripten_main_loop(void) {
 void *
 emulator_loop(void *param)
 {
-	uint32_t old_clockticks6502 = clockticks6502;
 	for (;;) {
 		if (smc_requested_reset) machine_reset();
 
@@ -1711,36 +1980,10 @@ emulator_loop(void *param)
 			continue;
 		}
 
-		instruction_counter += waiting ^ 0x1;
-
-		step6502();
-		uint32_t clocks = clockticks6502 - old_clockticks6502;
-		old_clockticks6502 = clockticks6502;
-		bool new_frame = false;
-		via1_step(clocks);
-		vera_spi_step(MHZ, clocks);
-		if (has_serial) {
-			serial_step(clocks);
-		}
-		if (has_via2) {
-			via2_step(clocks);
-		}
-		if (!headless) {
-			new_frame |= video_step(MHZ, clocks, false);
-		}
-
-		for (uint32_t i = 0; i < clocks; i++) {
-			i2c_step();
-		}
-		rtc_step(clocks);
-
-		if (!headless) {
-			audio_step(clocks);
-		}
-
-		midi_serial_step(clocks);
+		instruction_counter += machine_execute();
 
 		if (!headless && new_frame) {
+			new_frame = false;
 			if (nvram_dirty && nvram_path) {
 				SDL_RWops *f = SDL_RWFromFile(nvram_path, "wb");
 				if (f) {
@@ -1750,6 +1993,13 @@ emulator_loop(void *param)
 				nvram_dirty = false;
 			}
 
+			if (!rewinding) {
+				rewind_capture();
+			} else if (rewind_step_back()) {
+				// the CPU clock jumped back
+				timing_init();
+			}
+
 			if (!video_update()) {
 				break;
 			}
@@ -1761,14 +2011,7 @@ emulator_loop(void *param)
 #endif
 		}
 
-		// The optimization from the opportunistic batching of audio rendering
-		// is lost if we need to track the YM2151 IRQ, so it has been made a
-		// command-line switch that's disabled by default.
-		if (ym2151_irq_support) {
-			audio_render();
-		}
-
-		if (video_get_irq_out() || via1_irq() || (has_via2 && via2_irq()) || (ym2151_irq_support && YM_irq()) || (has_midi_card && midi_serial_irq())) {
+		if (machine_irq_out()) {
 //			printf("IRQ!\n");
 			irq6502();
 		}
@@ -1818,40 +2061,7 @@ emulator_loop(void *param)
 			}
 
 			if (regs.pc == 0xffcf) {
-				// as soon as BASIC starts reading a line...
-				static bool prg_done = false;
-
-				if (prg_file && !prg_done) {
-					int loadlen = 0;
-					// LOAD":*" will cause the IEEE library
-					// to load from "prg_file"
-					if (prg_override_start >= 0) {
-						loadlen = snprintf(paste_text_data, sizeof(paste_text_data), "LOAD\":*\",%d,1,$%04X\r", ieee_unit, prg_override_start);
-					} else {
-						loadlen = snprintf(paste_text_data, sizeof(paste_text_data), "LOAD\":*\",%d,1\r", ieee_unit);
-					}
-					paste_text = paste_text_data;
-					prg_done = true;
-
-					if (run_after_load) {
-						if (prg_override_start >= 0) {
-							snprintf(paste_text_data + loadlen, sizeof(paste_text_data) - loadlen, "SYS$%04X\r", prg_override_start);
-						} else {
-							snprintf(paste_text_data + loadlen, sizeof(paste_text_data) - loadlen, "RUN\r");
-						}
-					}
-				}
-				else if (testbench && !test_init_complete){
-					snprintf(paste_text_data, sizeof(paste_text_data), "SYS65533\r");
-					paste_text = paste_text_data;
-					test_init_complete=true;
-				}
-
-				if (paste_text) {
-					// ...paste BASIC code into the keyboard buffer
-					pasting_bas = true;
-					if (warp_pastes) warp_mode = true;
-				}
+				basic_input_poll();
 			}
 
 		}
@@ -1874,6 +2084,7 @@ emulator_loop(void *param)
 			if (c && !e) {
 				BRAM[KEYD - 0xa000 + BRAM[NDX - 0xa000]] = c;
 				BRAM[NDX - 0xa000]++;
+				BRAM_page_versions[(KEYD - 0xa000) >> 8]++;
 			} else {
 				pasting_bas = false;
 				if (warp_pastes) warp_mode = false;
@@ -19,30 +19,46 @@
 #include "cartridge.h"
 #include "iso_8859_15.h"
 #include "midi.h"
+#include "scheduler.h"
+#include "savestate.h"
 
-uint8_t ram_bank;
-uint8_t rom_bank;
+machine_local uint8_t ram_bank;
+machine_local uint8_t rom_bank;
 
-uint8_t *RAM, *BRAM;
+machine_local uint8_t *RAM, *BRAM;
 uint8_t ROM[ROM_SIZE];
 extern uint8_t *CART;
 
-static uint8_t addr_ym = 0;
+static machine_local uint8_t addr_ym = 0;
 
 bool randomizeRAM = false;
 bool reportUninitializedAccess = false;
 const char *reportUsageStatisticsFilename = NULL;
-bool *RAM_access_flags, *BRAM_access_flags;
-uint64_t *RAM_system_reads;
-uint64_t *RAM_system_writes;
-uint64_t *RAM_banked_reads[256];
-uint64_t *RAM_banked_writes[256];
-uint64_t *ROM_banked_reads[256];
-uint64_t *ROM_banked_writes[256];	// shouldn't occur for obvious reasons unless Bonk RAM is installed in a cart
-
-
-static uint32_t clock_snap = 0UL;
-static uint32_t clock_base = 0UL;
+machine_local bool *RAM_access_flags, *BRAM_access_flags;
+machine_local uint64_t *RAM_system_reads;
+machine_local uint64_t *RAM_system_writes;
+machine_local uint64_t *RAM_banked_reads[256];
+machine_local uint64_t *RAM_banked_writes[256];
+machine_local uint64_t *ROM_banked_reads[256];
+machine_local uint64_t *ROM_banked_writes[256];	// shouldn't occur for obvious reasons unless Bonk RAM is installed in a cart
+
+// write counters per 256 byte page, used by the CPU's decoded block cache
+// and by rewind
+machine_local uint32_t *RAM_page_versions, *BRAM_page_versions, *CART_page_versions;
+static const uint32_t ROM_page_version = 0;
+static const uint8_t no_bank = 0;
+machine_local uint32_t code_epoch = 0;
+
+// bank 0 page tables: host memory behind each 256 byte page, NULL where the
+// access needs the full decoding below (I/O, open bus, ROM writes)
+static machine_local uint8_t *read_pages[256];
+static machine_local uint8_t *write_pages[256];
+static machine_local uint32_t *write_page_versions[256];
+static machine_local uint32_t rom_page_version; // ROM is never written
+static machine_local bool track_accesses = false;
+
+static machine_local uint32_t clock_snap = 0UL;
+static machine_local uint32_t clock_base = 0UL;
 
 #define DEVICE_EMULATOR (0x9fb0)
 
@@ -54,6 +70,9 @@ memory_init()
 	// Initialize RAM array
 	RAM = calloc(RAM_SIZE, sizeof(uint8_t));
 	BRAM = calloc(BRAM_SIZE, sizeof(uint8_t));
+	RAM_page_versions = calloc(RAM_SIZE >> 8, sizeof(uint32_t));
+	BRAM_page_versions = calloc(BRAM_SIZE >> 8, sizeof(uint32_t));
+	CART_page_versions = calloc(CART_MAX_SIZE >> 8, sizeof(uint32_t));
 
 	if(reportUsageStatisticsFilename!=NULL) {
 		RAM_system_reads = calloc(num_banks * BANK_SIZE, sizeof(uint64_t));
@@ -85,6 +104,12 @@ memory_init()
 		}
 	}
 
+	for (int i = 0; i < 0x9f; i++) {
+		read_pages[i] = write_pages[i] = &RAM[i << 8];
+		write_page_versions[i] = &RAM_page_versions[i];
+	}
+	track_accesses = reportUninitializedAccess || reportUsageStatisticsFilename != NULL;
+
 	// Initialize RAM access flag array (if option selected)
 	if (reportUninitializedAccess) {
 		RAM_access_flags = (bool*) malloc(RAM_SIZE * sizeof(bool));
@@ -100,6 +125,21 @@ memory_init()
 	memory_reset();
 }
 
+void
+memory_shutdown()
+{
+	free(RAM);
+	free(BRAM);
+	free(RAM_page_versions);
+	free(BRAM_page_versions);
+	free(CART_page_versions);
+	free(RAM_access_flags);
+	free(BRAM_access_flags);
+	RAM = BRAM = NULL;
+	RAM_page_versions = BRAM_page_versions = CART_page_versions = NULL;
+	RAM_access_flags = BRAM_access_flags = NULL;
+}
+
 void
 memory_reset()
 {
@@ -112,11 +152,13 @@ void
 memory_report_uninitialized_access(bool value)
 {
 	reportUninitializedAccess = value;
+	track_accesses = reportUninitializedAccess || reportUsageStatisticsFilename != NULL;
 }
 
 void
 memory_report_usage_statistics(const char *filename) {
 	reportUsageStatisticsFilename = filename;
+	track_accesses = reportUninitializedAccess || reportUsageStatisticsFilename != NULL;
 }
 
 void
@@ -162,6 +204,12 @@ static const char *format_addr(uint16_t address, uint8_t bank, uint8_t x16Bank)
 uint8_t
 read6502(uint16_t address, uint8_t bank) {
 	if (!is_gen2) bank = 0;
+	if (bank == 0 && !track_accesses) {
+		const uint8_t *page = read_pages[address >> 8];
+		if (page) {
+			return page[address & 0xff];
+		}
+	}
 	// Report access to uninitialized RAM (if option selected)
 	if (reportUninitializedAccess) {
 		if (bank == 0) {
@@ -216,6 +264,9 @@ real_read6502(uint16_t address, uint8_t bank, bool debugOn, int16_t x16Bank)
 	if (address < 0x9f00) { // RAM
 		return RAM[address];
 	} else if (address < 0xa000) { // I/O
+		if (!debugOn) {
+			scheduler_io_access();
+		}
 		if (!debugOn && address >= 0x9fa0) {
 			// slow IO5-7 range
 			clockticks6502 += 3;
@@ -270,6 +321,17 @@ void
 write6502(uint16_t address, uint8_t bank, uint8_t value)
 {
 	if (!is_gen2) bank = 0;
+	if (bank == 0 && !track_accesses) {
+		uint8_t *page = write_pages[address >> 8];
+		if (page) {
+			if (address < 2) {
+				cpuio_write(address, value);
+			}
+			page[address & 0xff] = value;
+			(*write_page_versions[address >> 8])++;
+			return;
+		}
+	}
 
 	if(reportUsageStatisticsFilename!=NULL) {
 		if (bank != 0 || address < 0xa000) {
@@ -296,6 +358,7 @@ write6502(uint16_t address, uint8_t bank, uint8_t value)
 	if (is_gen2 && bank != 0) {
 		if (bank < num_banks) {
 			RAM[bank * BANK_SIZE + address] = value;
+			RAM_page_versions[(bank * BANK_SIZE + address) >> 8]++;
 		}
 		return;
 	}
@@ -307,7 +370,9 @@ write6502(uint16_t address, uint8_t bank, uint8_t value)
 	// Write to memory
 	if (address < 0x9f00) { // RAM
 		RAM[address] = value;
+		RAM_page_versions[address >> 8]++;
 	} else if (address < 0xa000) { // I/O
+		scheduler_io_access();
 		if (address >= 0x9fa0) {
 			// slow IO5-7 range
 			clockticks6502 += 3;
@@ -338,15 +403,71 @@ write6502(uint16_t address, uint8_t bank, uint8_t value)
 	} else if (address < 0xc000) { // banked RAM
 		if (memory_get_ram_bank() < num_ram_banks) {
 			BRAM[(memory_get_ram_bank() << 13) + address - 0xa000] = value;
+			BRAM_page_versions[((memory_get_ram_bank() << 13) + address - 0xa000) >> 8]++;
 		}
 	} else { // ROM
 		if (rom_bank >= 32) { // Cartridge ROM/RAM
 			cartridge_write(address, rom_bank, value);
+			CART_page_versions[((rom_bank - 32) << 6) + ((address - 0xc000) >> 8)]++;
 		}
 		// ignore if base ROM (banks 0-31)
 	}
 }
 
+//
+// host address of the code at address:bank for the CPU's decoded block cache,
+// along with the write counter of its page and the bank register mapping it
+//
+// NULL if the code may not be cached: I/O, cartridges, open bus and whenever
+// every read has to go through read6502()
+//
+
+const uint8_t *
+memory_code_pointer(uint16_t address, uint8_t bank, const uint32_t **version, const uint8_t **bankreg)
+{
+	if (reportUninitializedAccess || reportUsageStatisticsFilename != NULL) {
+		return NULL;
+	}
+	if (!is_gen2) bank = 0;
+
+	*bankreg = &no_bank;
+	if (bank != 0) {
+		if (bank >= num_banks) {
+			return NULL;
+		}
+		uint32_t offset = bank * BANK_SIZE + address;
+		*version = &RAM_page_versions[offset >> 8];
+		return &RAM[offset];
+	} else if (address < 0x9f00) {
+		*version = &RAM_page_versions[address >> 8];
+		return &RAM[address];
+	} else if (address < 0xa000) {
+		return NULL;
+	} else if (address < 0xc000) {
+		if (ram_bank >= num_ram_banks) {
+			return NULL;
+		}
+		uint32_t offset = (ram_bank << 13) + address - 0xa000;
+		*version = &BRAM_page_versions[offset >> 8];
+		*bankreg = &ram_bank;
+		return &BRAM[offset];
+	} else {
+		if (rom_bank >= 32) {
+			return NULL;
+		}
+		*version = &ROM_page_version;
+		*bankreg = &rom_bank;
+		return &ROM[(rom_bank << 14) + address - 0xc000];
+	}
+}
+
+// call after modifying RAM, BRAM or ROM without write6502()
+void
+memory_invalidate_code()
+{
+	code_epoch++;
+}
+
 void
 vp6502()
 {
@@ -445,6 +566,16 @@ inline void
 memory_set_ram_bank(uint8_t bank)
 {
 	ram_bank = bank;
+
+	for (int i = 0; i < 0x20; i++) {
+		if (ram_bank < num_ram_banks) {
+			uint32_t offset = (ram_bank << 13) + (i << 8);
+			read_pages[0xa0 + i] = write_pages[0xa0 + i] = &BRAM[offset];
+			write_page_versions[0xa0 + i] = &BRAM_page_versions[offset >> 8];
+		} else {
+			read_pages[0xa0 + i] = write_pages[0xa0 + i] = NULL;
+		}
+	}
 }
 
 inline uint8_t
@@ -457,6 +588,20 @@ inline void
 memory_set_rom_bank(uint8_t bank)
 {
 	rom_bank = bank;
+
+	uint8_t *mem = NULL;
+	bool writable = false;
+	if (rom_bank < 32) {
+		mem = &ROM[rom_bank << 14];
+	} else if (CART) {
+		mem = &CART[(rom_bank - 32) << 14];
+		writable = cartridge_get_bank_type(rom_bank) >= CART_BANK_UNINITIALIZED_RAM;
+	}
+	for (int i = 0; i < 0x40; i++) {
+		read_pages[0xc0 + i] = mem ? &mem[i << 8] : NULL;
+		write_pages[0xc0 + i] = writable ? &mem[i << 8] : NULL;
+		write_page_versions[0xc0 + i] = writable ? &CART_page_versions[((rom_bank - 32) << 6) + i] : &rom_page_version;
+	}
 }
 
 inline uint8_t
@@ -520,6 +665,10 @@ void
 emu_write(uint8_t reg, uint8_t value)
 {
 	bool v = value != 0;
+	if (reg < 8 && !machine_is_host()) {
+		// the options and recorders are x16emu's
+		return;
+	}
 	switch (reg) {
 		case 0: debugger_enabled = v; break;
 		case 1: log_video = v; break;
@@ -588,3 +737,31 @@ emu_read(uint8_t reg, bool debugOn)
 	if (!debugOn) printf("WARN: Invalid register %x\n", DEVICE_EMULATOR + reg);
 	return -1;
 }
+
+void
+memory_state(state_t *s)
+{
+	STATE(s, ram_bank);
+	STATE(s, rom_bank);
+	if (!s->devices_only) {
+		state_data(s, RAM, RAM_SIZE);
+		state_data(s, BRAM, BRAM_SIZE);
+	}
+	if (CART && !s->devices_only) {
+		// the ROM banks are part of the image, the RAM banks are state
+		for (int bank = 32; bank < 256; bank++) {
+			if (cartridge_get_bank_type(bank) >= CART_BANK_UNINITIALIZED_RAM) {
+				state_data(s, &CART[(bank - 32) << 14], 0x4000);
+			}
+		}
+	}
+	STATE(s, addr_ym);
+	STATE(s, clock_snap);
+	STATE(s, clock_base);
+
+	if (s->loading) {
+		memory_set_ram_bank(ram_bank);
+		memory_set_rom_bank(rom_bank);
+		memory_invalidate_code();
+	}
+}
@@ -9,6 +9,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <SDL.h>
+#include "machine.h"
 
 #define BANK_SIZE 65536
 
@@ -53,8 +54,15 @@ uint8_t read6502(uint16_t address, uint8_t bank);
 uint8_t real_read6502(uint16_t address, uint8_t bank, bool debugOn, int16_t x16Bank);
 void write6502(uint16_t address, uint8_t bank, uint8_t value);
 void vp6502();
+const uint8_t *memory_code_pointer(uint16_t address, uint8_t bank, const uint32_t **version, const uint8_t **bankreg);
+void memory_invalidate_code();
+
+// write counters per 256 byte page, not updated by memory_invalidate_code() writes
+extern machine_local uint32_t *RAM_page_versions, *BRAM_page_versions, *CART_page_versions;
+extern machine_local uint32_t code_epoch;
 
 void memory_init();
+void memory_shutdown();
 void memory_reset();
 void memory_report_uninitialized_access(bool);
 void memory_report_usage_statistics(const char *filename);
@@ -8,6 +8,7 @@
 #include "midi.h"
 #include "audio.h"
 #include "endian.h"
+#include "scheduler.h"
 
 #ifdef _WIN32
     #include <windows.h>
@@ -707,6 +708,22 @@ void midi_serial_step(int clocks)
     }
 }
 
+// clocks until the next UART bit time of either port
+uint32_t midi_serial_next_event()
+{
+    uint32_t next = SCHEDULER_NO_EVENT;
+    uint8_t sel;
+    for (sel=0; sel<2; sel++) {
+        if (mregs[sel].clockdec > 0) {
+            int64_t clocks = mregs[sel].clock / mregs[sel].clockdec + 1;
+            if (clocks < next) {
+                next = (uint32_t)clocks;
+            }
+        }
+    }
+    return next;
+}
+
 uint8_t midi_serial_dequeue_ibyte(uint8_t sel)
 {
     pthread_mutex_lock(&mregs[sel].fifo_mutex);
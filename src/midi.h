@@ -38,6 +38,7 @@
 void midi_init(void);
 void midi_serial_init(void);
 void midi_serial_step(int clocks);
+uint32_t midi_serial_next_event();
 uint8_t midi_serial_read(uint8_t reg, bool debugOn);
 void midi_serial_write(uint8_t reg, uint8_t val);
 void midi_load_sf2(uint8_t* filename);
@@ -0,0 +1,227 @@
+// Commander X16 Emulator
+// Copyright (c) 2019 Michael Steil
+// All rights reserved. License: 2-clause BSD
+
+#include "recorder.h"
+
+#include "SDL.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// The queue is a ring of records, each a header and the data of its job.
+// The emulation thread only moves the head and the recorder thread only
+// moves the tail, so neither has to take a lock. The positions count bytes
+// and wrap around, the size has to be a power of two.
+#define RECORDER_QUEUE_SIZE (16 << 20)
+#define RECORDER_QUEUE_MASK (RECORDER_QUEUE_SIZE - 1)
+
+// the data follows the header at this alignment
+#define RECORD_ALIGN 16
+#define RECORD_SIZE(size) ((RECORD_ALIGN + (size) + RECORD_ALIGN - 1) & ~(uint32_t)(RECORD_ALIGN - 1))
+
+struct record {
+	recorder_job_t job; // NULL skips to the start of the ring
+	uint32_t size;
+};
+
+static uint8_t *queue = NULL;
+static SDL_atomic_t queue_head;
+static SDL_atomic_t queue_tail;
+static SDL_atomic_t producer_waiting;
+static SDL_sem *records_queued = NULL; // posted once for every record
+static SDL_sem *space_freed = NULL;
+static SDL_Thread *recorder_thread = NULL;
+static bool recorder_started = false;
+static bool recorder_quit = false;
+
+// the record being filled in
+static recorder_job_t pending_job;
+static uint32_t pending_size;
+static uint32_t pending_head;
+
+// without a thread, a job runs as soon as it is submitted
+static uint8_t *direct_buffer = NULL;
+static uint32_t direct_buffer_size = 0;
+
+// backpressure statistics
+static uint32_t stat_records = 0;
+static uint64_t stat_bytes = 0;
+static uint32_t stat_waits = 0;
+static uint64_t stat_wait_ticks = 0;
+static uint32_t stat_peak_fill = 0;
+
+static int
+recorder_main(void *arg)
+{
+	(void)arg;
+	uint32_t tail = 0;
+	while (!recorder_quit) {
+		SDL_SemWait(records_queued);
+		SDL_MemoryBarrierAcquire();
+
+		struct record *record = (struct record *)&queue[tail & RECORDER_QUEUE_MASK];
+		if (!record->job) {
+			tail += RECORDER_QUEUE_SIZE - (tail & RECORDER_QUEUE_MASK);
+			record = (struct record *)queue;
+		}
+		record->job((uint8_t *)record + RECORD_ALIGN, record->size);
+		tail += RECORD_SIZE(record->size);
+
+		SDL_MemoryBarrierRelease();
+		SDL_AtomicSet(&queue_tail, tail);
+		if (SDL_AtomicCAS(&producer_waiting, 1, 0)) {
+			SDL_SemPost(space_freed);
+		}
+	}
+	return 0;
+}
+
+static void
+recorder_stop_job(void *data, uint32_t size)
+{
+	(void)data;
+	(void)size;
+	recorder_quit = true;
+}
+
+static void
+recorder_start()
+{
+	recorder_started = true;
+#ifndef __EMSCRIPTEN__
+	queue = malloc(RECORDER_QUEUE_SIZE);
+	records_queued = SDL_CreateSemaphore(0);
+	space_freed = SDL_CreateSemaphore(0);
+	SDL_AtomicSet(&queue_head, 0);
+	SDL_AtomicSet(&queue_tail, 0);
+	SDL_AtomicSet(&producer_waiting, 0);
+	recorder_quit = false;
+	if (queue && records_queued && space_freed) {
+		recorder_thread = SDL_CreateThread(recorder_main, "x16emu recorder", NULL);
+	}
+	if (!recorder_thread) {
+		printf("Cannot start the recorder thread, recording on the CPU thread.\n");
+		free(queue);
+		queue = NULL;
+	}
+#endif
+}
+
+static uint32_t
+queue_free(uint32_t head)
+{
+	const uint32_t tail = SDL_AtomicGet(&queue_tail);
+	SDL_MemoryBarrierAcquire();
+	return RECORDER_QUEUE_SIZE - (head - tail);
+}
+
+void *
+recorder_queue(recorder_job_t job, uint32_t size)
+{
+	if (!recorder_started) {
+		recorder_start();
+	}
+	pending_job = job;
+	pending_size = size;
+
+	if (!recorder_thread) {
+		if (!direct_buffer || direct_buffer_size < size) {
+			free(direct_buffer);
+			direct_buffer = malloc(size + 1);
+			direct_buffer_size = direct_buffer ? size + 1 : 0;
+		}
+		return direct_buffer;
+	}
+
+	if (RECORD_SIZE(size) > RECORDER_QUEUE_SIZE / 2) {
+		printf("Cannot queue %u bytes for recording.\n", size);
+		return NULL;
+	}
+
+	// a record that doesn't fit before the end of the ring starts over
+	const uint32_t head = SDL_AtomicGet(&queue_head);
+	const uint32_t offset = head & RECORDER_QUEUE_MASK;
+	const uint32_t skip = offset + RECORD_SIZE(size) > RECORDER_QUEUE_SIZE ? RECORDER_QUEUE_SIZE - offset : 0;
+	const uint32_t needed = skip + RECORD_SIZE(size);
+
+	if (queue_free(head) < needed) {
+		const uint64_t start = SDL_GetPerformanceCounter();
+		stat_waits++;
+		for (;;) {
+			// The recorder thread wakes us up if it frees space after we
+			// have said that we wait, otherwise we see the space here.
+			// The CAS is a full barrier, the timeout is only a safety net.
+			SDL_AtomicCAS(&producer_waiting, 0, 1);
+			if (queue_free(head) >= needed) {
+				SDL_AtomicCAS(&producer_waiting, 1, 0);
+				break;
+			}
+			SDL_SemWaitTimeout(space_freed, 10);
+		}
+		stat_wait_ticks += SDL_GetPerformanceCounter() - start;
+	}
+
+	const uint32_t fill = RECORDER_QUEUE_SIZE - queue_free(head) + needed;
+	if (fill > stat_peak_fill) {
+		stat_peak_fill = fill;
+	}
+
+	if (skip) {
+		((struct record *)&queue[offset])->job = NULL;
+	}
+	struct record *record = (struct record *)&queue[(head + skip) & RECORDER_QUEUE_MASK];
+	record->job = job;
+	record->size = size;
+	pending_head = head + needed;
+	return (uint8_t *)record + RECORD_ALIGN;
+}
+
+void
+recorder_submit()
+{
+	stat_records++;
+	stat_bytes += pending_size;
+
+	if (!recorder_thread) {
+		pending_job(direct_buffer, pending_size);
+		return;
+	}
+
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet(&queue_head, pending_head);
+	SDL_SemPost(records_queued);
+}
+
+void
+recorder_shutdown()
+{
+	if (!recorder_started) {
+		return;
+	}
+
+	if (recorder_thread) {
+		if (recorder_queue(recorder_stop_job, 0)) {
+			recorder_submit();
+		}
+		SDL_WaitThread(recorder_thread, NULL);
+		recorder_thread = NULL;
+
+		// the stop record isn't a recording
+		printf("Recorder: %u records, %.1f MB, queue peak %.1f of %d MB, waited %u times for %.0f ms.\n",
+			stat_records - 1, stat_bytes / 1048576.0,
+			stat_peak_fill / 1048576.0, RECORDER_QUEUE_SIZE >> 20,
+			stat_waits, stat_wait_ticks * 1000.0 / SDL_GetPerformanceFrequency());
+	}
+
+	free(queue);
+	free(direct_buffer);
+	SDL_DestroySemaphore(records_queued);
+	SDL_DestroySemaphore(space_freed);
+	queue = NULL;
+	direct_buffer = NULL;
+	direct_buffer_size = 0;
+	records_queued = NULL;
+	space_freed = NULL;
+	recorder_started = false;
+}
@@ -0,0 +1,24 @@
+// Commander X16 Emulator
+// Copyright (c) 2019 Michael Steil
+// All rights reserved. License: 2-clause BSD
+
+#ifndef _RECORDER_H_
+#define _RECORDER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// A job gets the data that was queued with it, on the recorder thread.
+typedef void (*recorder_job_t)(void *data, uint32_t size);
+
+// Jobs run one after the other in the order they were queued. Only the
+// emulation thread queues them. recorder_queue() returns the space to fill
+// in, waiting for the recorder thread if the queue is full, and the job runs
+// once recorder_submit() has been called.
+void *recorder_queue(recorder_job_t job, uint32_t size);
+void recorder_submit();
+
+// Run the jobs that are still queued, then stop the recorder thread.
+void recorder_shutdown();
+
+#endif
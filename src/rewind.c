@@ -0,0 +1,273 @@
+// Commander X16 Emulator
+// Copyright (c) 2019 Michael Steil
+// All rights reserved. License: 2-clause BSD
+
+// The rewind buffer is a ring of captures, one per frame. A capture only
+// holds the device state; RAM, BRAM, cartridge RAM and VRAM are kept as a
+// shadow copy of their contents at the newest capture. The next capture
+// finds the 256 byte pages that have been written since by their write
+// counters and moves their old contents from the shadow into the undo list
+// of the capture before. Stepping back reverts the pages written since the
+// newest capture from the shadow, and then applies the undo list of the
+// capture before it. The undo lists together are kept below a budget by
+// dropping the oldest captures.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rewind.h"
+#include "glue.h"
+#include "memory.h"
+#include "video.h"
+#include "cartridge.h"
+#include "savestate.h"
+
+enum {
+	REGION_RAM,
+	REGION_BRAM,
+	REGION_VRAM,
+	REGION_CART,
+	NUM_REGIONS
+};
+
+#define PAGE_ID(region, page) ((region) << 24 | (page))
+
+#define UNDO_BUDGET (64 << 20)
+
+typedef struct {
+	uint8_t *devices;
+	size_t devices_size;
+	uint32_t *page_ids;
+	uint8_t *pages;       // contents at this capture of the pages written until the next one
+	uint32_t num_pages;
+	uint32_t max_pages;
+} capture_t;
+
+typedef struct {
+	uint8_t *shadow;
+	uint32_t *seen;       // write counters at the newest capture
+	uint32_t num_pages;
+} region_t;
+
+static machine_local capture_t *captures;
+static machine_local int num_captures;
+static machine_local int oldest, count;
+static machine_local region_t regions[NUM_REGIONS];
+static machine_local uint32_t seen_epoch;
+static machine_local size_t undo_bytes;
+
+static uint8_t *
+page_memory(int region, uint32_t page)
+{
+	switch (region) {
+		case REGION_RAM:
+			return &RAM[page << 8];
+		case REGION_BRAM:
+			return &BRAM[page << 8];
+		case REGION_VRAM:
+			return video_ram_page(page);
+		default:
+			return &CART[page << 8];
+	}
+}
+
+static uint32_t *
+page_versions(int region)
+{
+	switch (region) {
+		case REGION_RAM:
+			return RAM_page_versions;
+		case REGION_BRAM:
+			return BRAM_page_versions;
+		case REGION_VRAM:
+			return video_ram_page_versions;
+		default:
+			return CART_page_versions;
+	}
+}
+
+static bool
+page_tracked(int region, uint32_t page)
+{
+	return region != REGION_CART || cartridge_get_bank_type(32 + (page >> 6)) >= CART_BANK_UNINITIALIZED_RAM;
+}
+
+static bool
+page_modified(int region, uint32_t page)
+{
+	uint32_t *versions = page_versions(region);
+	region_t *r = &regions[region];
+
+	if (versions[page] != r->seen[page]) {
+		return true;
+	}
+	// memory_invalidate_code() announces writes that bypassed the counters
+	if (region != REGION_VRAM && code_epoch != seen_epoch) {
+		return memcmp(page_memory(region, page), &r->shadow[page << 8], 256) != 0;
+	}
+	return false;
+}
+
+static void
+add_undo(capture_t *c, uint32_t id, const uint8_t *data)
+{
+	if (c->num_pages == c->max_pages) {
+		c->max_pages = c->max_pages ? c->max_pages * 2 : 64;
+		c->page_ids = realloc(c->page_ids, c->max_pages * sizeof(uint32_t));
+		c->pages = realloc(c->pages, c->max_pages * 256);
+	}
+	c->page_ids[c->num_pages] = id;
+	memcpy(&c->pages[c->num_pages << 8], data, 256);
+	c->num_pages++;
+	undo_bytes += 256;
+}
+
+static void
+drop_oldest()
+{
+	capture_t *c = &captures[oldest];
+	undo_bytes -= (size_t)c->num_pages << 8;
+	c->num_pages = 0;
+	oldest = (oldest + 1) % num_captures;
+	count--;
+}
+
+// drop the history that doesn't fit into the budget, and its memory
+static void
+trim_history()
+{
+	while (undo_bytes > UNDO_BUDGET && count > 2) {
+		capture_t *c = &captures[oldest];
+		drop_oldest();
+		free(c->page_ids);
+		free(c->pages);
+		c->page_ids = NULL;
+		c->pages = NULL;
+		c->max_pages = 0;
+	}
+}
+
+// the memory page has been written behind its write counter's back
+static void
+page_restored(int region, uint32_t page)
+{
+	regions[region].seen[page] = ++page_versions(region)[page];
+}
+
+void
+rewind_init(int frames)
+{
+	if (frames < 2) {
+		return;
+	}
+	num_captures = frames;
+	captures = calloc(frames, sizeof(capture_t));
+	oldest = 0;
+	count = 0;
+	undo_bytes = 0;
+
+	regions[REGION_RAM].num_pages = RAM_SIZE >> 8;
+	regions[REGION_BRAM].num_pages = BRAM_SIZE >> 8;
+	regions[REGION_VRAM].num_pages = 0x20000 >> 8;
+	regions[REGION_CART].num_pages = CART ? CART_MAX_SIZE >> 8 : 0;
+	for (int region = 0; region < NUM_REGIONS; region++) {
+		region_t *r = &regions[region];
+		uint32_t *versions = page_versions(region);
+
+		r->shadow = malloc(r->num_pages << 8);
+		r->seen = calloc(r->num_pages, sizeof(uint32_t));
+		for (uint32_t page = 0; page < r->num_pages; page++) {
+			memcpy(&r->shadow[page << 8], page_memory(region, page), 256);
+			r->seen[page] = versions[page];
+		}
+	}
+	seen_epoch = code_epoch;
+}
+
+void
+rewind_capture()
+{
+	if (!captures) {
+		return;
+	}
+
+	capture_t *prev = count ? &captures[(oldest + count - 1) % num_captures] : NULL;
+	if (count == num_captures) {
+		drop_oldest();
+	}
+	capture_t *c = &captures[(oldest + count) % num_captures];
+	count++;
+
+	// syncs the devices, so it goes first
+	size_t size = savestate_devices_size();
+	if (size != c->devices_size) {
+		c->devices = realloc(c->devices, size);
+		c->devices_size = size;
+	}
+	savestate_write_devices(c->devices, size);
+	c->num_pages = 0;
+
+	for (int region = 0; region < NUM_REGIONS; region++) {
+		region_t *r = &regions[region];
+		uint32_t *versions = page_versions(region);
+
+		for (uint32_t page = 0; page < r->num_pages; page++) {
+			if (!page_tracked(region, page) || !page_modified(region, page)) {
+				continue;
+			}
+			if (prev) {
+				add_undo(prev, PAGE_ID(region, page), &r->shadow[page << 8]);
+			}
+			memcpy(&r->shadow[page << 8], page_memory(region, page), 256);
+			r->seen[page] = versions[page];
+		}
+	}
+	seen_epoch = code_epoch;
+
+	trim_history();
+}
+
+bool
+rewind_enabled()
+{
+	return captures != NULL;
+}
+
+// Go back to the capture before the newest one, which is dropped.
+bool
+rewind_step_back()
+{
+	if (count < 2) {
+		return false;
+	}
+
+	// back to the newest capture
+	for (int region = 0; region < NUM_REGIONS; region++) {
+		region_t *r = &regions[region];
+
+		for (uint32_t page = 0; page < r->num_pages; page++) {
+			if (page_tracked(region, page) && page_modified(region, page)) {
+				memcpy(page_memory(region, page), &r->shadow[page << 8], 256);
+				page_restored(region, page);
+			}
+		}
+	}
+
+	count--;
+	capture_t *c = &captures[(oldest + count - 1) % num_captures];
+	for (uint32_t i = 0; i < c->num_pages; i++) {
+		int region = c->page_ids[i] >> 24;
+		uint32_t page = c->page_ids[i] & 0xffffff;
+
+		memcpy(page_memory(region, page), &c->pages[i << 8], 256);
+		memcpy(&regions[region].shadow[page << 8], &c->pages[i << 8], 256);
+		page_restored(region, page);
+	}
+	undo_bytes -= (size_t)c->num_pages << 8;
+	c->num_pages = 0;
+
+	// restores the banking, which invalidates the decoded code
+	savestate_read_devices(c->devices, c->devices_size);
+	seen_epoch = code_epoch;
+	return true;
+}
@@ -0,0 +1,15 @@
+// Commander X16 Emulator
+// Copyright (c) 2019 Michael Steil
+// All rights reserved. License: 2-clause BSD
+
+#ifndef _REWIND_H_
+#define _REWIND_H_
+
+#include <stdbool.h>
+
+void rewind_init(int frames);
+void rewind_capture();
+bool rewind_enabled();
+bool rewind_step_back();
+
+#endif
@@ -13,26 +13,27 @@
 #include <time.h>
 #include "rtc.h"
 #include "glue.h"
+#include "savestate.h"
 
-bool nvram_dirty = false;
-uint8_t nvram[0x40];
+machine_local bool nvram_dirty = false;
+machine_local uint8_t nvram[0x40];
 
-static bool running;
-static bool vbaten;
-static bool h24;
+static machine_local bool running;
+static machine_local bool vbaten;
+static machine_local bool h24;
 
-static unsigned int clocks;
-static int seconds;
-static int minutes;
-static int hours;
-static int day_of_week;
-static int day;
-static int month;
-static int year;
+static machine_local unsigned int clocks;
+static machine_local int seconds;
+static machine_local int minutes;
+static machine_local int hours;
+static machine_local int day_of_week;
+static machine_local int day;
+static machine_local int month;
+static machine_local int year;
 
 #define I2C_DATA_LEN 16
-static uint8_t i2c_data[I2C_DATA_LEN];
-static uint8_t i2c_data_pos = 0;
+static machine_local uint8_t i2c_data[I2C_DATA_LEN];
+static machine_local uint8_t i2c_data_pos = 0;
 
 void
 rtc_i2c_data(uint8_t v) {
@@ -257,3 +258,21 @@ rtc_write() {
 	i2c_data_pos = 0;
 }
 
+void
+rtc_state(state_t *s)
+{
+	STATE(s, nvram);
+	STATE(s, running);
+	STATE(s, vbaten);
+	STATE(s, h24);
+	STATE(s, clocks);
+	STATE(s, seconds);
+	STATE(s, minutes);
+	STATE(s, hours);
+	STATE(s, day_of_week);
+	STATE(s, day);
+	STATE(s, month);
+	STATE(s, year);
+	STATE(s, i2c_data);
+	STATE(s, i2c_data_pos);
+}
@@ -0,0 +1,314 @@
+// Commander X16 Emulator
+// Copyright (c) 2019 Michael Steil
+// All rights reserved. License: 2-clause BSD
+
+// Save states hold the complete state of the machine. The layout is an 8
+// byte magic and the format version, followed by one chunk per subsystem:
+// a four character id, the version of the subsystem's layout, the size of
+// its data and the data itself, padded so that every chunk starts 8 byte
+// aligned. Numbers are in host byte order, a save state is meant for the
+// emulator build and configuration (-ram, cartridge, ...) that wrote it.
+// Loading copies the data straight back into the variables; it fails
+// without touching the machine if any chunk doesn't match.
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <SDL.h>
+#include "savestate.h"
+#include "glue.h"
+#include "machine.h"
+#include "scheduler.h"
+#include "cpu/fake6502.h"
+
+#define SAVESTATE_MAGIC "X16STATE"
+
+typedef struct {
+	char magic[8];
+	uint32_t version;
+	uint32_t num_chunks;
+} file_header_t;
+
+typedef struct {
+	char id[4];
+	uint32_t version;
+	uint64_t size;
+} chunk_header_t;
+
+static const struct {
+	char id[5];
+	uint32_t version;
+	void (*state)(state_t *s);
+} chunks[] = {
+	{ "CPU ", 1, cpu_state },
+	{ "MEM ", 1, memory_state },
+	{ "SCHD", 1, scheduler_state },
+	{ "VIA ", 1, via_state },
+	{ "VERA", 1, video_state },
+	{ "PSG ", 1, psg_state },
+	{ "PCM ", 1, pcm_state },
+	{ "SPI ", 1, vera_spi_state },
+	{ "SDC ", 1, sdcard_state },
+	{ "I2C ", 1, i2c_state },
+	{ "SMC ", 1, smc_state },
+	{ "RTC ", 1, rtc_state },
+	{ "IEC ", 1, serial_state },
+	{ "YM  ", 1, YM_state },
+};
+
+#define NUM_CHUNKS (sizeof(chunks) / sizeof(*chunks))
+
+void
+state_data(state_t *s, void *data, size_t size)
+{
+	if (s->error) {
+		return;
+	}
+	if (s->data) {
+		if (size > s->capacity - s->pos) {
+			s->error = true;
+			return;
+		}
+		if (s->loading) {
+			memcpy(data, s->data + s->pos, size);
+		} else {
+			memcpy(s->data + s->pos, data, size);
+		}
+	}
+	s->pos += size;
+}
+
+static void
+state_align(state_t *s)
+{
+	static const uint8_t zero[8];
+	size_t padding = -s->pos & 7;
+
+	if (s->loading) {
+		if (padding > s->capacity - s->pos) {
+			s->error = true;
+		} else {
+			s->pos += padding;
+		}
+	} else {
+		state_data(s, (void *)zero, padding);
+	}
+}
+
+void
+cpu_state(state_t *s)
+{
+	STATE(s, regs);
+	STATE(s, clockticks6502);
+	STATE(s, waiting);
+	if (s->loading) {
+		update6502mode();
+	}
+}
+
+static size_t
+chunk_size(int i, bool devices_only)
+{
+	state_t s = { NULL, SIZE_MAX, 0, false, false, devices_only };
+	chunks[i].state(&s);
+	return s.pos;
+}
+
+// writes the state, or only measures it if there is no buffer
+static size_t
+write_state(uint8_t *buffer, size_t size, bool devices_only)
+{
+	state_t s = { buffer, size, 0, false, false, devices_only };
+	file_header_t header;
+
+	// bring the devices to the CPU's clock
+	scheduler_sync();
+
+	memcpy(header.magic, SAVESTATE_MAGIC, sizeof(header.magic));
+	header.version = SAVESTATE_VERSION;
+	header.num_chunks = NUM_CHUNKS;
+	STATE(&s, header);
+
+	for (int i = 0; i < NUM_CHUNKS; i++) {
+		chunk_header_t chunk;
+		size_t chunk_pos = s.pos;
+
+		memcpy(chunk.id, chunks[i].id, sizeof(chunk.id));
+		chunk.version = chunks[i].version;
+		chunk.size = 0;
+		STATE(&s, chunk);
+		chunks[i].state(&s);
+		chunk.size = s.pos - chunk_pos - sizeof(chunk);
+		if (s.data && !s.error) {
+			memcpy(s.data + chunk_pos, &chunk, sizeof(chunk));
+		}
+		state_align(&s);
+	}
+
+	// the devices' next events may have changed
+	scheduler_expire();
+
+	return s.error ? 0 : s.pos;
+}
+
+size_t
+savestate_size()
+{
+	return write_state(NULL, SIZE_MAX, false);
+}
+
+bool
+savestate_write(uint8_t *buffer, size_t size)
+{
+	return write_state(buffer, size, false) != 0;
+}
+
+size_t
+savestate_devices_size()
+{
+	return write_state(NULL, SIZE_MAX, true);
+}
+
+bool
+savestate_write_devices(uint8_t *buffer, size_t size)
+{
+	return write_state(buffer, size, true) != 0;
+}
+
+// check all headers before anything gets loaded
+static bool
+check_state(const uint8_t *buffer, size_t size, bool devices_only)
+{
+	state_t s = { (uint8_t *)buffer, size, 0, true, false, devices_only };
+	file_header_t header;
+
+	STATE(&s, header);
+	if (s.error || memcmp(header.magic, SAVESTATE_MAGIC, sizeof(header.magic))) {
+		printf("Not a save state!\n");
+		return false;
+	}
+	if (header.version != SAVESTATE_VERSION || header.num_chunks != NUM_CHUNKS) {
+		printf("Unsupported save state version %u!\n", header.version);
+		return false;
+	}
+
+	for (int i = 0; i < NUM_CHUNKS; i++) {
+		chunk_header_t chunk;
+
+		STATE(&s, chunk);
+		if (s.error || memcmp(chunk.id, chunks[i].id, sizeof(chunk.id)) || chunk.version != chunks[i].version) {
+			printf("Unsupported save state chunk \"%s\"!\n", chunks[i].id);
+			return false;
+		}
+		if (chunk.size != chunk_size(i, devices_only)) {
+			printf("Save state chunk \"%s\" doesn't match the machine configuration!\n", chunks[i].id);
+			return false;
+		}
+		if (chunk.size > s.capacity - s.pos) {
+			printf("Save state is truncated!\n");
+			return false;
+		}
+		if (chunks[i].state == cpu_state) {
+			// the chunk starts with the registers, -c816 has to match
+			struct regs saved;
+			memcpy(&saved, buffer + s.pos, sizeof(saved));
+			if (saved.is65c816 != regs.is65c816) {
+				printf("Save state is for the %s, not the %s!\n", saved.is65c816 ? "65C816" : "65C02", regs.is65c816 ? "65C816" : "65C02");
+				return false;
+			}
+		}
+		s.pos += chunk.size;
+		state_align(&s);
+	}
+	return !s.error;
+}
+
+static bool
+read_state(const uint8_t *buffer, size_t size, bool devices_only)
+{
+	if (!check_state(buffer, size, devices_only)) {
+		return false;
+	}
+
+	state_t s = { (uint8_t *)buffer, size, sizeof(file_header_t), true, false, devices_only };
+	for (int i = 0; i < NUM_CHUNKS; i++) {
+		s.pos += sizeof(chunk_header_t);
+		chunks[i].state(&s);
+		state_align(&s);
+	}
+	if (s.error) {
+		// can only be a chunk with a length field that lies about its size
+		printf("Save state is corrupt!\n");
+	}
+
+	machine_sync();
+	return !s.error;
+}
+
+bool
+savestate_read(const uint8_t *buffer, size_t size)
+{
+	return read_state(buffer, size, false);
+}
+
+bool
+savestate_read_devices(const uint8_t *buffer, size_t size)
+{
+	return read_state(buffer, size, true);
+}
+
+bool
+savestate_save(const char *path, bool quiet)
+{
+	size_t size = savestate_size();
+	uint8_t *buffer = malloc(size);
+	if (!buffer || !savestate_write(buffer, size)) {
+		printf("Cannot create save state!\n");
+		free(buffer);
+		return false;
+	}
+
+	SDL_RWops *f = SDL_RWFromFile(path, "wb");
+	if (!f) {
+		printf("Cannot write to %s!\n", path);
+		free(buffer);
+		return false;
+	}
+	size_t written = SDL_RWwrite(f, buffer, 1, size);
+	SDL_RWclose(f);
+	free(buffer);
+	if (written != size) {
+		printf("Cannot write to %s!\n", path);
+		return false;
+	}
+	if (!quiet) {
+		printf("Saved state to %s.\n", path);
+	}
+	return true;
+}
+
+bool
+savestate_load(const char *path, bool quiet)
+{
+	SDL_RWops *f = SDL_RWFromFile(path, "rb");
+	if (!f) {
+		printf("Cannot open %s!\n", path);
+		return false;
+	}
+	Sint64 size = SDL_RWsize(f);
+	uint8_t *buffer = size > 0 ? malloc(size) : NULL;
+	if (!buffer || SDL_RWread(f, buffer, 1, size) != size) {
+		printf("Cannot read %s!\n", path);
+		SDL_RWclose(f);
+		free(buffer);
+		return false;
+	}
+	SDL_RWclose(f);
+
+	bool ok = savestate_read(buffer, size);
+	free(buffer);
+	if (ok && !quiet) {
+		printf("Loaded state from %s.\n", path);
+	}
+	return ok;
+}
@@ -0,0 +1,65 @@
+// Commander X16 Emulator
+// Copyright (c) 2019 Michael Steil
+// All rights reserved. License: 2-clause BSD
+
+#ifndef _SAVESTATE_H_
+#define _SAVESTATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define SAVESTATE_VERSION 1
+
+// One pass over the state of a subsystem. Every subsystem has a single
+// function that hands each of its variables to state_data(), which copies
+// it into the snapshot or back out of it, depending on the direction.
+typedef struct {
+	uint8_t *data;   // snapshot buffer, NULL to only measure the size
+	size_t capacity;
+	size_t pos;
+	bool loading;
+	bool error;      // the snapshot is too short
+	bool devices_only; // without RAM, BRAM, cartridge RAM and VRAM
+} state_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void state_data(state_t *s, void *data, size_t size);
+#define STATE(s, var) state_data((s), &(var), sizeof(var))
+
+size_t savestate_size();
+bool savestate_write(uint8_t *buffer, size_t size);
+bool savestate_read(const uint8_t *buffer, size_t size);
+// quiet only reports errors, for files the user doesn't know about
+bool savestate_save(const char *path, bool quiet);
+bool savestate_load(const char *path, bool quiet);
+
+// the rewind buffer keeps the memory contents itself
+size_t savestate_devices_size();
+bool savestate_write_devices(uint8_t *buffer, size_t size);
+bool savestate_read_devices(const uint8_t *buffer, size_t size);
+
+// the subsystems
+void cpu_state(state_t *s);
+void memory_state(state_t *s);
+void scheduler_state(state_t *s);
+void via_state(state_t *s);
+void video_state(state_t *s);
+void psg_state(state_t *s);
+void pcm_state(state_t *s);
+void vera_spi_state(state_t *s);
+void sdcard_state(state_t *s);
+void i2c_state(state_t *s);
+void smc_state(state_t *s);
+void rtc_state(state_t *s);
+void serial_state(state_t *s);
+void YM_state(state_t *s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,116 @@
+// Commander X16 Emulator
+// Copyright (c) 2019 Michael Steil
+// All rights reserved. License: 2-clause BSD
+
+// Devices are not stepped after every CPU instruction. They are brought up to
+// the CPU clock in batches: when the CPU reaches the earliest event any device
+// has announced (a timer IRQ, the end of a scanline), and before every access
+// to the I/O area, so the CPU always sees their current state.
+
+#include <stdio.h>
+#include "scheduler.h"
+#include "cpu/fake6502.h"
+#include "savestate.h"
+
+typedef struct {
+	device_step_t step;
+	device_next_event_t next_event;
+} device_t;
+
+static machine_local device_t devices[SCHEDULER_MAX_DEVICES];
+static machine_local int num_devices;
+static machine_local uint32_t synced_clockticks; // clockticks6502 the devices have been stepped to
+
+machine_local uint64_t scheduler_clocks;   // total clocks the devices have been stepped
+machine_local uint32_t scheduler_deadline; // clockticks6502 at the earliest device event
+
+void
+scheduler_init()
+{
+	num_devices = 0;
+	synced_clockticks = clockticks6502;
+	scheduler_clocks = 0;
+	scheduler_deadline = clockticks6502;
+}
+
+void
+scheduler_add_device(device_step_t step, device_next_event_t next_event)
+{
+	if (num_devices == SCHEDULER_MAX_DEVICES) {
+		printf("Too many devices for the scheduler!\n");
+		return;
+	}
+	devices[num_devices].step = step;
+	devices[num_devices].next_event = next_event;
+	num_devices++;
+	scheduler_deadline = synced_clockticks;
+}
+
+static uint32_t
+next_event(bool *every_instruction)
+{
+	uint32_t next = SCHEDULER_MAX_BATCH;
+	for (int i = 0; i < num_devices; i++) {
+		if (devices[i].next_event) {
+			uint32_t clocks = devices[i].next_event();
+			if (clocks == SCHEDULER_EVERY_INSTRUCTION) {
+				*every_instruction = true;
+			} else if (clocks < next) {
+				next = clocks;
+			}
+		}
+	}
+	return next;
+}
+
+void
+scheduler_sync()
+{
+	uint32_t pending = clockticks6502 - synced_clockticks;
+	bool every_instruction = false;
+	uint32_t next = next_event(&every_instruction);
+
+	// never step past an event, the devices only handle one per step
+	while (pending > 0) {
+		uint32_t clocks = pending < next ? pending : next;
+		for (int i = 0; i < num_devices; i++) {
+			devices[i].step(clocks);
+		}
+		synced_clockticks += clocks;
+		scheduler_clocks += clocks;
+		pending -= clocks;
+
+		every_instruction = false;
+		next = next_event(&every_instruction);
+	}
+
+	scheduler_deadline = synced_clockticks + (every_instruction ? 0 : next);
+}
+
+// make the deadline due, so the devices' next events and IRQ outputs
+// get re-evaluated after the current instruction
+void
+scheduler_expire()
+{
+	scheduler_deadline = synced_clockticks;
+}
+
+// called before a device register is read or written
+void
+scheduler_io_access()
+{
+	scheduler_sync();
+	// the access can change the device's next event and its IRQ output
+	scheduler_expire();
+}
+
+// saved after scheduler_sync(), so the devices are at the CPU's clock
+void
+scheduler_state(state_t *s)
+{
+	STATE(s, synced_clockticks);
+	STATE(s, scheduler_clocks);
+	if (s->loading) {
+		scheduler_expire();
+	}
+}
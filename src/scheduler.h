@@ -0,0 +1,36 @@
+// Commander X16 Emulator
+// Copyright (c) 2019 Michael Steil
+// All rights reserved. License: 2-clause BSD
+
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "machine.h"
+#include "cpu/fake6502.h"
+
+#define SCHEDULER_MAX_DEVICES 16
+#define SCHEDULER_MAX_BATCH 65536 // clocks between syncs if no device has an event
+#define SCHEDULER_EVERY_INSTRUCTION 0
+#define SCHEDULER_NO_EVENT UINT32_MAX
+
+// Advance the device by the given number of clocks.
+typedef void (*device_step_t)(unsigned clocks);
+// Clocks until the device's next event (IRQ, end of scanline, ...), SCHEDULER_NO_EVENT,
+// or SCHEDULER_EVERY_INSTRUCTION to be stepped after every instruction.
+typedef uint32_t (*device_next_event_t)();
+
+void scheduler_init();
+void scheduler_add_device(device_step_t step, device_next_event_t next_event);
+void scheduler_sync();
+void scheduler_io_access();
+void scheduler_expire();
+
+extern machine_local uint64_t scheduler_clocks;
+extern machine_local uint32_t scheduler_deadline;
+
+// true once the CPU has reached the earliest device deadline
+#define scheduler_due() ((int32_t)(clockticks6502 - scheduler_deadline) >= 0)
+
+#endif
@@ -13,6 +13,7 @@
 #include <string.h>
 #include "sdcard.h"
 #include "files.h"
+#include "savestate.h"
 
 //#define VERBOSE 1
 
@@ -42,23 +43,24 @@ enum {
 };
 
 static char sdcard_path[PATH_MAX] = "";
-static struct x16file *sdcard_file = NULL;
-bool sdcard_attached = false;
+static machine_local struct x16file *sdcard_file = NULL;
+machine_local bool sdcard_attached = false;
 
-static uint8_t rxbuf[3 + 512];
-static int rxbuf_idx;
-static uint32_t lba;
-static uint8_t last_cmd;
-static bool is_acmd = false;
-static bool is_idle = true;
-static bool is_initialized = false;
-static bool ongoing_multiblock_read = false;
+static machine_local uint8_t rxbuf[3 + 512];
+static machine_local int rxbuf_idx;
+static machine_local uint32_t lba;
+static machine_local uint8_t last_cmd;
+static machine_local bool is_acmd = false;
+static machine_local bool is_idle = true;
+static machine_local bool is_initialized = false;
+static machine_local bool ongoing_multiblock_read = false;
 
-static const uint8_t *response = NULL;
-static int response_length = 0;
-static int response_counter = 0;
+static machine_local const uint8_t *response = NULL;
+static machine_local int response_length = 0;
+static machine_local int response_counter = 0;
+static machine_local uint8_t restored_response[2 + 512 + 2];
 
-static bool selected = false;
+static machine_local bool selected = false;
 
 void
 sdcard_set_path(char const *path)
@@ -118,7 +120,7 @@ sdcard_select(bool select)
 static void
 set_response_csd(void)
 {
-	static uint8_t rr[] = {
+	static machine_local uint8_t rr[] = {
 		0xff, // dummy
 		0xff, // dummy
 		0x00, // R1 response
@@ -153,7 +155,7 @@ set_response_csd(void)
 static void
 set_response_r1(void)
 {
-	static uint8_t r1;
+	static machine_local uint8_t r1;
 	r1 = is_idle ? 1 : 0;
 	response = &r1;
 	response_length = 1;
@@ -228,7 +230,7 @@ sdcard_handle(uint8_t inbyte)
 			outbyte = response[response_counter++];
 			if (response_counter == response_length) {
 				if (ongoing_multiblock_read) {
-					static uint8_t read_multiblock_next_response[1 + 512 + 2];
+					static machine_local uint8_t read_multiblock_next_response[1 + 512 + 2];
 					// Prepare next multiblock reply
 					lba++;
 					response_length = loadBlock(&read_multiblock_next_response[0]);
@@ -322,7 +324,7 @@ sdcard_handle(uint8_t inbyte)
 				case CMD17: {
 					// READ_SINGLE_BLOCK
 					lba = (rxbuf[1] << 24) | (rxbuf[2] << 16) | (rxbuf[3] << 8) | rxbuf[4];
-					static uint8_t read_block_response[2 + 512 + 2];
+					static machine_local uint8_t read_block_response[2 + 512 + 2];
 					read_block_response[0] = 0; // R1 response to command
 					response_length = 1 + loadBlock(&read_block_response[1]);
 					// Stop multiblock read if error
@@ -394,3 +396,35 @@ sdcard_handle(uint8_t inbyte)
 	}
 	return outbyte;
 }
+
+// The card image is not part of the state, only the SPI protocol.
+void
+sdcard_state(state_t *s)
+{
+	bool has_response = response != NULL;
+
+	STATE(s, rxbuf);
+	STATE(s, rxbuf_idx);
+	STATE(s, lba);
+	STATE(s, last_cmd);
+	STATE(s, is_acmd);
+	STATE(s, is_idle);
+	STATE(s, is_initialized);
+	STATE(s, ongoing_multiblock_read);
+	STATE(s, selected);
+	STATE(s, response_length);
+	STATE(s, response_counter);
+	STATE(s, has_response);
+	if (!s->loading && has_response && response != restored_response) {
+		// points into one of the static response buffers
+		memcpy(restored_response, response, response_length);
+	}
+	STATE(s, restored_response);
+	if (s->loading) {
+		if (response_length < 0 || (size_t)response_length > sizeof(restored_response)) {
+			response_length = 0;
+			has_response = false;
+		}
+		response = has_response ? restored_response : NULL;
+	}
+}
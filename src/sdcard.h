@@ -6,8 +6,9 @@
 #include <inttypes.h>
 #include <stdbool.h>
 #include <SDL.h>
+#include "machine.h"
 
-extern bool sdcard_attached;
+extern machine_local bool sdcard_attached;
 void sdcard_set_path(char const *path);
 bool sdcard_path_is_set();
 void sdcard_attach();
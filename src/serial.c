@@ -13,19 +13,21 @@
 #include "serial.h"
 #include "ieee.h"
 #include "glue.h"
+#include "savestate.h"
 
-serial_port_t serial_port;
+machine_local serial_port_t serial_port;
 
-static int state = 0;
-static bool valid;
-static int bit;
-static uint8_t byte;
-static bool listening = false;
-static bool talking = false;
-static bool during_atn = false;
-static bool eoi = false;
-static bool fnf = false; // file not found
-static int clocks_since_last_change = 0;
+static machine_local int state = 0;
+static machine_local bool valid;
+static machine_local int bit;
+static machine_local uint8_t byte;
+static machine_local bool listening = false;
+static machine_local bool talking = false;
+static machine_local bool during_atn = false;
+static machine_local bool eoi = false;
+static machine_local bool fnf = false; // file not found
+static machine_local int clocks_since_last_change = 0;
+static machine_local bool old_atn = false, old_clk = false, old_data = false;
 
 #define printf(...)
 
@@ -55,7 +57,6 @@ serial_step(int clocks)
 {
 	bool print = false;
 
-	static bool old_atn = false, old_clk = false, old_data = false;
 	if (old_atn == serial_port.in.atn &&
 		old_clk == serial_port_read_clk() &&
 		old_data == serial_port_read_data()) {
@@ -251,3 +252,21 @@ serial_step(int clocks)
 	old_data = serial_port_read_data();
 }
 
+void
+serial_state(state_t *s)
+{
+	STATE(s, serial_port);
+	STATE(s, state);
+	STATE(s, valid);
+	STATE(s, bit);
+	STATE(s, byte);
+	STATE(s, listening);
+	STATE(s, talking);
+	STATE(s, during_atn);
+	STATE(s, eoi);
+	STATE(s, fnf);
+	STATE(s, clocks_since_last_change);
+	STATE(s, old_atn);
+	STATE(s, old_clk);
+	STATE(s, old_data);
+}
@@ -6,6 +6,7 @@
 #define SERIAL_H
 
 #include <stdint.h>
+#include "machine.h"
 
 #define SERIAL_ATNIN_MASK   (1<<3)
 #define SERIAL_CLOCKIN_MASK (1<<4)
@@ -23,7 +24,7 @@ typedef struct {
 	} out;
 } serial_port_t;
 
-extern serial_port_t serial_port;
+extern machine_local serial_port_t serial_port;
 
 void serial_step(int clocks);
 
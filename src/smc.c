@@ -10,6 +10,7 @@
 #include "smc.h"
 #include "glue.h"
 #include "i2c.h"
+#include "savestate.h"
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
 #endif
@@ -21,14 +22,14 @@
 // 0x04 0x00-0xFF - Power LED Level (PWM)
 // 0x05 0x00-0xFF - Activity LED Level (PWM)
 
-uint8_t default_read_op = 0x41;
-uint8_t default_read_state = 0;
-uint8_t activity_led;
-uint8_t mse_count = 0;
+machine_local uint8_t default_read_op = 0x41;
+machine_local uint8_t default_read_state = 0;
+machine_local uint8_t activity_led;
+machine_local uint8_t mse_count = 0;
 #define I2C_DATA_LEN 16
-static uint8_t i2c_data[I2C_DATA_LEN];
-static uint8_t i2c_data_pos = 0;
-bool smc_requested_reset = false;
+static machine_local uint8_t i2c_data[I2C_DATA_LEN];
+static machine_local uint8_t i2c_data_pos = 0;
+machine_local bool smc_requested_reset = false;
 
 void
 smc_i2c_data(uint8_t v) {
@@ -174,3 +175,14 @@ smc_write() {
 	i2c_data_pos = 0;
 }
 
+void
+smc_state(state_t *s)
+{
+	STATE(s, default_read_op);
+	STATE(s, default_read_state);
+	STATE(s, activity_led);
+	STATE(s, mse_count);
+	STATE(s, i2c_data);
+	STATE(s, i2c_data_pos);
+	STATE(s, smc_requested_reset);
+}
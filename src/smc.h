@@ -10,12 +10,13 @@
 #define SMC_VERSION_PATCH 0
 
 #include <stdint.h>
+#include "machine.h"
 
 extern void nmi6502();
 void smc_i2c_data(uint8_t v);
 uint8_t smc_read();
 void smc_write();
 
-extern bool smc_requested_reset;
+extern machine_local bool smc_requested_reset;
 
 #endif
@@ -205,6 +205,7 @@ void testbench_init()
                     invalid();
                 } else {
                     regs.status = (uint8_t)ival;
+                    update6502mode();
                     ready();
                 }
             }
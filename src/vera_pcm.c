@@ -3,21 +3,23 @@
 // All rights reserved. License: 2-clause BSD
 
 #include "vera_pcm.h"
+#include "machine.h"
+#include "savestate.h"
 #include <stdio.h>
 
-static uint8_t  fifo[4096];
-static unsigned fifo_wridx;
-static unsigned fifo_rdidx;
-static unsigned fifo_cnt;
+static machine_local uint8_t  fifo[4096];
+static machine_local unsigned fifo_wridx;
+static machine_local unsigned fifo_rdidx;
+static machine_local unsigned fifo_cnt;
 
-static uint8_t ctrl;
-static uint8_t rate;
-static uint8_t loop;
+static machine_local uint8_t ctrl;
+static machine_local uint8_t rate;
+static machine_local uint8_t loop;
 
 static uint8_t volume_lut[16] = {0, 1, 2, 3, 4, 5, 6, 8, 11, 14, 18, 23, 30, 38, 49, 64};
 
-static int16_t cur_l, cur_r;
-static uint8_t phase;
+static machine_local int16_t cur_l, cur_r;
+static machine_local uint8_t phase;
 
 static void
 fifo_reset(void)
@@ -102,7 +104,7 @@ pcm_write_fifo(uint8_t val)
 static uint8_t
 read_fifo()
 {
-	static uint8_t result = 0;
+	static machine_local uint8_t result = 0;
 	if (fifo_cnt == 0) {
 		return 0;
 	}
@@ -120,6 +122,25 @@ pcm_is_fifo_almost_empty(void)
 	return fifo_cnt < 1024;
 }
 
+// Samples until the FIFO is almost empty, 0 if it already is and UINT32_MAX
+// if it never gets there because nothing is played.
+uint32_t
+pcm_samples_until_almost_empty(void)
+{
+	static const uint8_t bytes_per_sample[4] = { 1, 2, 2, 4 };
+
+	if (fifo_cnt < 1024) {
+		return 0;
+	}
+	if (rate == 0) {
+		return UINT32_MAX;
+	}
+	// the FIFO is read whenever bit 7 of the phase changes
+	const uint8_t bytes = bytes_per_sample[(ctrl >> 4) & 3];
+	const uint32_t reads = (fifo_cnt - 1023 + bytes - 1) / bytes;
+	return (128 * reads - (phase & 127) + rate - 1) / rate;
+}
+
 void
 pcm_render(int16_t *buf, unsigned num_samples)
 {
@@ -180,3 +201,18 @@ pcm_render(int16_t *buf, unsigned num_samples)
 		*(buf++) = (int16_t)((int32_t)cur_r * volume_lut[ctrl & 0xF] / 64);
 	}
 }
+
+void
+pcm_state(state_t *s)
+{
+	STATE(s, fifo);
+	STATE(s, fifo_wridx);
+	STATE(s, fifo_rdidx);
+	STATE(s, fifo_cnt);
+	STATE(s, ctrl);
+	STATE(s, rate);
+	STATE(s, loop);
+	STATE(s, cur_l);
+	STATE(s, cur_r);
+	STATE(s, phase);
+}
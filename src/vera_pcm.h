@@ -15,3 +15,4 @@ uint8_t pcm_read_rate(void);
 void    pcm_write_fifo(uint8_t val);
 void    pcm_render(int16_t *buf, unsigned num_samples);
 bool    pcm_is_fifo_almost_empty(void);
+uint32_t pcm_samples_until_almost_empty(void);
@@ -3,6 +3,8 @@
 // All rights reserved. License: 2-clause BSD
 
 #include "vera_psg.h"
+#include "machine.h"
+#include "savestate.h"
 
 #include <stdbool.h>
 #include <string.h>
@@ -25,7 +27,7 @@ struct channel {
 	uint32_t phase;
 };
 
-static struct channel channels[16];
+static machine_local struct channel channels[16];
 
 static uint16_t volume_lut[64] = {
 	  0,                                           4,   8,  12,
@@ -36,7 +38,7 @@ static uint16_t volume_lut[64] = {
 	270, 286, 303, 321, 341, 361, 382, 405, 429, 455, 482, 511
 };
 
-static uint16_t noise_state;
+static machine_local uint16_t noise_state;
 
 void
 psg_reset(void)
@@ -124,3 +126,10 @@ psg_render(int16_t *buf, unsigned num_samples)
 		buf += 2;
 	}
 }
+
+void
+psg_state(state_t *s)
+{
+	STATE(s, channels);
+	STATE(s, noise_state);
+}
@@ -5,14 +5,15 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include "sdcard.h"
+#include "savestate.h"
 
 #define SPI_CLOCK_RATE_MHZ 12.5f
 
-bool ss;
-bool busy;
-bool autotx;
-uint8_t sending_byte, received_byte;
-float outcounter;
+machine_local bool ss;
+machine_local bool busy;
+machine_local bool autotx;
+machine_local uint8_t sending_byte, received_byte;
+machine_local float outcounter;
 
 void
 vera_spi_init()
@@ -82,3 +83,14 @@ vera_spi_write(uint8_t reg, uint8_t value)
 			break;
 	}
 }
+
+void
+vera_spi_state(state_t *s)
+{
+	STATE(s, ss);
+	STATE(s, busy);
+	STATE(s, autotx);
+	STATE(s, sending_byte);
+	STATE(s, received_byte);
+	STATE(s, outcounter);
+}
@@ -6,6 +6,7 @@
 #include "i2c.h"
 #include "memory.h"
 #include "serial.h"
+#include "scheduler.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
@@ -13,6 +14,7 @@
 //XXX
 #include "glue.h"
 #include "joystick.h"
+#include "savestate.h"
 
 typedef struct {
 	unsigned timer_count[2];
@@ -23,7 +25,7 @@ typedef struct {
 	bool pb7_output;
 } via_t;
 
-static via_t via[2];
+static machine_local via_t via[2];
 
 // only internal logic is handled here, see via1/2 calls for external
 // operations specific to each unit
@@ -173,9 +175,9 @@ via_step(via_t *via, unsigned clocks)
 			}
 			if (tclk - cnt == 1) {
 				// special, -1 state
+				tclk_s = cnt + 1;
 				cnt = 0xffff;
 				via->timer1_m1 = true;
-				tclk_s = 1;
 			} else {
 				reload = (((uint32_t)via->registers[7] << 8) | via->registers[6]);
 				tclk_s = cnt + reload + 2;
@@ -208,6 +210,20 @@ via_step(via_t *via, unsigned clocks)
 	via->registers[13] = ifr;
 }
 
+// clocks until a running timer underflows, which sets its IFR bit
+static uint32_t
+via_next_event(via_t *via)
+{
+	uint32_t next = SCHEDULER_NO_EVENT;
+	if (via->timer_running[0]) {
+		next = via->timer1_m1 ? 1 : via->timer_count[0] + 1;
+	}
+	if (via->timer_running[1] && !(via->registers[11] & 0x20) && via->timer_count[1] + 1 < next) {
+		next = via->timer_count[1] + 1;
+	}
+	return next;
+}
+
 //
 // VIA#1
 //
@@ -318,6 +334,12 @@ via1_step(unsigned clocks)
 	via_step(&via[0], clocks);
 }
 
+uint32_t
+via1_next_event()
+{
+	return via_next_event(&via[0]);
+}
+
 bool
 via1_irq()
 {
@@ -355,8 +377,20 @@ via2_step(unsigned clocks)
 	via_step(&via[1], clocks);
 }
 
+uint32_t
+via2_next_event()
+{
+	return via_next_event(&via[1]);
+}
+
 bool
 via2_irq()
 {
 	return (via[1].registers[13] & via[1].registers[14]) != 0;
 }
+
+void
+via_state(state_t *s)
+{
+	STATE(s, via);
+}
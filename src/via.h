@@ -12,12 +12,14 @@ void via1_init();
 uint8_t via1_read(uint8_t reg, bool debug);
 void via1_write(uint8_t reg, uint8_t value);
 void via1_step(unsigned clocks);
+uint32_t via1_next_event();
 bool via1_irq();
 
 void via2_init();
 uint8_t via2_read(uint8_t reg, bool debug);
 void via2_write(uint8_t reg, uint8_t value);
 void via2_step(unsigned clocks);
+uint32_t via2_next_event();
 bool via2_irq();
 
 #endif
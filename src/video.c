@@ -13,7 +13,8 @@
 #include "glue.h"
 #include "debugger.h"
 #include "keyboard.h"
-#include "gif.h"
+#include "gif_recorder.h"
+#include "recorder.h"
 #include "joystick.h"
 #include "vera_spi.h"
 #include "vera_psg.h"
@@ -22,11 +23,16 @@
 #include "sdcard.h"
 #include "i2c.h"
 #include "audio.h"
+#include "savestate.h"
+#include "rewind.h"
 
 #include <stdbool.h>
 #include <limits.h>
 #include <stdint.h>
 #include <time.h>
+#ifdef MACHINE_LOCAL_PER_THREAD
+#include <pthread.h>
+#endif
 
 #ifdef __EMSCRIPTEN__
 #include "emscripten.h"
@@ -88,51 +94,93 @@
 #define LAYER_PIXELS_PER_ITERATION 8
 
 #define MAX(a,b) ((a) > (b) ? a : b)
+#define MIN(a,b) ((a) < (b) ? a : b)
 
 static SDL_Window *window;
 static SDL_Renderer *renderer;
 static SDL_Texture *sdlTexture;
+static SDL_Texture *led_texture;
 static bool is_fullscreen = false;
 bool mouse_grabbed = false;
 bool no_keyboard_capture = false;
 bool kernal_mouse_enabled = false;
 
-static uint8_t video_ram[0x20000];
-static uint8_t palette[256 * 2];
-static uint8_t sprite_data[128][8];
+// VRAM and the tile row cache are on the heap, the thread-local storage
+// that every thread of the process gets only holds the pointers. The
+// machine gets them from video_create(), every render thread has its own.
+#define VIDEO_RAM_SIZE 0x20000
+
+static machine_local uint8_t *video_ram;
+// write counters per 256 byte page of VRAM
+machine_local uint32_t video_ram_page_versions[0x200];
+
+// Decoded tile rows, indexed by their VRAM address. An entry is valid while
+// the write counter of its VRAM page hasn't moved; a row never straddles
+// two pages, as it is aligned to its own size.
+#define TILE_ROW_CACHE_SIZE 4096
+
+struct tile_row_cache_entry {
+	uint32_t key;     // address, color depth and tile width
+	uint32_t version; // page write counter when decoded
+	uint8_t  pixels[16];
+};
+
+static machine_local struct tile_row_cache_entry *tile_row_cache;
+
+static machine_local uint8_t palette[256 * 2];
+static machine_local uint8_t sprite_data[128][8];
 
 // I/O registers
-static uint32_t io_addr[2];
-static uint8_t io_rddata[2];
-static uint8_t io_inc[2];
-static uint8_t io_addrsel;
-static uint8_t io_dcsel;
+static machine_local uint32_t io_addr[2];
+static machine_local uint8_t io_rddata[2];
+static machine_local uint8_t io_inc[2];
+static machine_local uint8_t io_addrsel;
+static machine_local uint8_t io_dcsel;
 
-static uint8_t ien;
-static uint8_t isr;
+static machine_local uint8_t ien;
+static machine_local uint8_t isr;
 
-static uint16_t irq_line;
+static machine_local uint16_t irq_line;
 
-static uint8_t reg_layer[2][7];
+static machine_local uint8_t reg_layer[2][7];
 
 #define COMPOSER_SLOTS 4*64
-static uint8_t reg_composer[COMPOSER_SLOTS];
-static uint8_t prev_reg_composer[2][COMPOSER_SLOTS];
-
-static uint8_t layer_line[2][SCREEN_WIDTH];
-static uint8_t sprite_line_col[SCREEN_WIDTH];
-static uint8_t sprite_line_z[SCREEN_WIDTH];
-static uint8_t sprite_line_mask[SCREEN_WIDTH];
-static uint8_t sprite_line_collisions;
-static bool layer_line_enable[2];
-static bool old_layer_line_enable[2];
-static bool old_sprite_line_enable;
-static bool sprite_line_enable;
+static machine_local uint8_t reg_composer[COMPOSER_SLOTS];
+static machine_local uint8_t prev_reg_composer[2][COMPOSER_SLOTS];
+
+static machine_local uint8_t layer_line[2][SCREEN_WIDTH];
+static machine_local uint8_t sprite_line_col[SCREEN_WIDTH];
+static machine_local uint8_t sprite_line_z[SCREEN_WIDTH];
+static machine_local uint8_t sprite_line_mask[SCREEN_WIDTH];
+static machine_local uint8_t sprite_line_collisions;
+// the span of the sprite line buffers that the last line has written
+static machine_local uint16_t sprite_line_dirty_begin, sprite_line_dirty_end;
+static machine_local bool layer_line_enable[2];
+static machine_local bool old_layer_line_enable[2];
+static machine_local bool old_sprite_line_enable;
+static machine_local bool sprite_line_enable;
+// layer and sprite line clears that haven't been drawn yet
+static machine_local uint16_t layer_clear_from[2] = {SCREEN_WIDTH, SCREEN_WIDTH};
+static machine_local bool sprite_line_cleared;
+
+// What the sprite line has been rendered from. It is rendered again when
+// any of it changes, otherwise the parts of a line split by midline writes
+// and the lines of a vertically scaled sprite line share it, up to the end
+// of the frame, where the collisions start over.
+struct sprite_line_key {
+	bool     valid;
+	uint16_t eff_y;
+	uint32_t sprite_version;
+	uint32_t pages[0x200 / 32]; // the VRAM pages the sprites have read
+	uint32_t page_versions;     // the sum of their write counters
+};
+
+static machine_local struct sprite_line_key sprite_line_key;
 
 ////////////////////////////////////////////////////////////
 // FX registers
 ////////////////////////////////////////////////////////////
-static uint8_t fx_addr1_mode;
+static machine_local uint8_t fx_addr1_mode;
 
 // These are all 16.16 fixed point in the emulator
 // even though the VERA uses smaller bit widths
@@ -141,44 +189,44 @@ static uint8_t fx_addr1_mode;
 // Sign extension is done manually when assigning negative numbers
 //
 // Native VERA bit widths are shown below.
-static uint32_t fx_x_pixel_increment;  // 11.9 fixed point (6.9 without 32x multiplier, 11.4 with 32x multiplier on)
-static uint32_t fx_y_pixel_increment;  // 11.9 fixed point (6.9 without 32x multiplier, 11.4 with 32x multiplier on)
-static uint32_t fx_x_pixel_position;   // 11.9 fixed point
-static uint32_t fx_y_pixel_position;   // 11.9 fixed point
+static machine_local uint32_t fx_x_pixel_increment;  // 11.9 fixed point (6.9 without 32x multiplier, 11.4 with 32x multiplier on)
+static machine_local uint32_t fx_y_pixel_increment;  // 11.9 fixed point (6.9 without 32x multiplier, 11.4 with 32x multiplier on)
+static machine_local uint32_t fx_x_pixel_position;   // 11.9 fixed point
+static machine_local uint32_t fx_y_pixel_position;   // 11.9 fixed point
 
-static uint16_t fx_poly_fill_length;      // 10 bits
+static machine_local uint16_t fx_poly_fill_length;      // 10 bits
 
-static uint32_t fx_affine_tile_base;
-static uint32_t fx_affine_map_base;
+static machine_local uint32_t fx_affine_tile_base;
+static machine_local uint32_t fx_affine_map_base;
 
-static uint8_t fx_affine_map_size;
+static machine_local uint8_t fx_affine_map_size;
 
-static bool fx_4bit_mode;
-static bool fx_16bit_hop;
-static bool fx_cache_byte_cycling;
-static bool fx_cache_fill;
-static bool fx_cache_write;
-static bool fx_trans_writes;
+static machine_local bool fx_4bit_mode;
+static machine_local bool fx_16bit_hop;
+static machine_local bool fx_cache_byte_cycling;
+static machine_local bool fx_cache_fill;
+static machine_local bool fx_cache_write;
+static machine_local bool fx_trans_writes;
 
-static bool fx_2bit_poly;
-static bool fx_2bit_poking;
+static machine_local bool fx_2bit_poly;
+static machine_local bool fx_2bit_poking;
 
-static bool fx_cache_increment_mode;
-static bool fx_cache_nibble_index;
-static uint8_t fx_cache_byte_index;
-static bool fx_multiplier;
-static bool fx_subtract;
+static machine_local bool fx_cache_increment_mode;
+static machine_local bool fx_cache_nibble_index;
+static machine_local uint8_t fx_cache_byte_index;
+static machine_local bool fx_multiplier;
+static machine_local bool fx_subtract;
 
-static bool fx_affine_clip;
+static machine_local bool fx_affine_clip;
 
-static uint8_t fx_16bit_hop_align;
+static machine_local uint8_t fx_16bit_hop_align;
 
-static bool fx_nibble_bit[2];
-static bool fx_nibble_incr[2];
+static machine_local bool fx_nibble_bit[2];
+static machine_local bool fx_nibble_incr[2];
 
-static uint8_t fx_cache[4];
+static machine_local uint8_t fx_cache[4];
 
-static int32_t fx_mult_accumulator;
+static machine_local int32_t fx_mult_accumulator;
 
 static const uint8_t vera_version_string[] = {'V',
 	VERA_VERSION_MAJOR,
@@ -186,19 +234,32 @@ static const uint8_t vera_version_string[] = {'V',
 	VERA_VERSION_PATCH
 };
 
-float vga_scan_pos_x;
-uint16_t vga_scan_pos_y;
-float ntsc_half_cnt;
-uint16_t ntsc_scan_pos_y;
-int frame_count = 0;
+machine_local float vga_scan_pos_x;
+machine_local uint16_t vga_scan_pos_y;
+machine_local float ntsc_half_cnt;
+machine_local uint16_t ntsc_scan_pos_y;
+machine_local int frame_count = 0;
 
+// The display and the line cache belong to x16emu's own machine, headless
+// machines on other threads leave them alone.
 static uint8_t framebuffer[SCREEN_WIDTH * SCREEN_HEIGHT * 4];
-#ifndef __EMSCRIPTEN__
-static uint8_t png_buffer[SCREEN_WIDTH * SCREEN_HEIGHT * 3];
-#endif
-
-static GifWriter gif_writer;
+// changes whenever the layer or sprite lines are touched outside of
+// rendering a whole line, which invalidates all cached lines
+static uint32_t line_cache_epoch;
+// the rows of the framebuffer that have been drawn since the last
+// video_update(), which are the ones the texture needs
+struct row_range {
+	uint16_t begin;
+	uint16_t end;
+};
+static struct row_range framebuffer_changed = { 0, SCREEN_HEIGHT };
 
+static inline void
+add_changed_rows(struct row_range *rows, uint16_t begin, uint16_t end)
+{
+	rows->begin = MIN(rows->begin, begin);
+	rows->end = MAX(rows->end, end);
+}
 static const uint16_t default_palette[] = {
 0x000,0xfff,0x800,0xafe,0xc4c,0x0c5,0x00a,0xee7,0xd85,0x640,0xf77,0x333,0x777,0xaf6,0x08f,0xbbb,0x000,0x111,0x222,0x333,0x444,0x555,0x666,0x777,0x888,0x999,0xaaa,0xbbb,0xccc,0xddd,0xeee,0xfff,0x211,0x433,0x644,0x866,0xa88,0xc99,0xfbb,0x211,0x422,0x633,0x844,0xa55,0xc66,0xf77,0x200,0x411,0x611,0x822,0xa22,0xc33,0xf33,0x200,0x400,0x600,0x800,0xa00,0xc00,0xf00,0x221,0x443,0x664,0x886,0xaa8,0xcc9,0xfeb,0x211,0x432,0x653,0x874,0xa95,0xcb6,0xfd7,0x210,0x431,0x651,0x862,0xa82,0xca3,0xfc3,0x210,0x430,0x640,0x860,0xa80,0xc90,0xfb0,0x121,0x343,0x564,0x786,0x9a8,0xbc9,0xdfb,0x121,0x342,0x463,0x684,0x8a5,0x9c6,0xbf7,0x120,0x241,0x461,0x582,0x6a2,0x8c3,0x9f3,0x120,0x240,0x360,0x480,0x5a0,0x6c0,0x7f0,0x121,0x343,0x465,0x686,0x8a8,0x9ca,0xbfc,0x121,0x242,0x364,0x485,0x5a6,0x6c8,0x7f9,0x020,0x141,0x162,0x283,0x2a4,0x3c5,0x3f6,0x020,0x041,0x061,0x082,0x0a2,0x0c3,0x0f3,0x122,0x344,0x466,0x688,0x8aa,0x9cc,0xbff,0x122,0x244,0x366,0x488,0x5aa,0x6cc,0x7ff,0x022,0x144,0x166,0x288,0x2aa,0x3cc,0x3ff,0x022,0x044,0x066,0x088,0x0aa,0x0cc,0x0ff,0x112,0x334,0x456,0x668,0x88a,0x9ac,0xbcf,0x112,0x224,0x346,0x458,0x56a,0x68c,0x79f,0x002,0x114,0x126,0x238,0x24a,0x35c,0x36f,0x002,0x014,0x016,0x028,0x02a,0x03c,0x03f,0x112,0x334,0x546,0x768,0x98a,0xb9c,0xdbf,0x112,0x324,0x436,0x648,0x85a,0x96c,0xb7f,0x102,0x214,0x416,0x528,0x62a,0x83c,0x93f,0x102,0x204,0x306,0x408,0x50a,0x60c,0x70f,0x212,0x434,0x646,0x868,0xa8a,0xc9c,0xfbe,0x211,0x423,0x635,0x847,0xa59,0xc6b,0xf7d,0x201,0x413,0x615,0x826,0xa28,0xc3a,0xf3c,0x201,0x403,0x604,0x806,0xa08,0xc09,0xf0b
 };
@@ -207,6 +268,11 @@ uint8_t video_space_read(uint32_t address);
 static void video_space_read_range(uint8_t* dest, uint32_t address, uint32_t size);
 
 static void refresh_palette();
+static void reset_layer_properties();
+static void render_thread_start(int threads);
+static void render_thread_stop();
+static void render_thread_sync();
+static void render_thread_fetch_lines();
 
 void
 mousegrab_toggle() {
@@ -218,9 +284,33 @@ mousegrab_toggle() {
 	video_update_title(window_title);
 }
 
+bool
+video_create()
+{
+	video_ram = malloc(VIDEO_RAM_SIZE);
+	tile_row_cache = malloc(TILE_ROW_CACHE_SIZE * sizeof(struct tile_row_cache_entry));
+	if (!video_ram || !tile_row_cache) {
+		video_destroy();
+		return false;
+	}
+	memset(tile_row_cache, 0xff, TILE_ROW_CACHE_SIZE * sizeof(struct tile_row_cache_entry));
+	return true;
+}
+
+void
+video_destroy()
+{
+	free(video_ram);
+	free(tile_row_cache);
+	video_ram = NULL;
+	tile_row_cache = NULL;
+}
+
 void
 video_reset()
 {
+	render_thread_sync();
+
 	// init I/O registers
 	memset(io_addr, 0, sizeof(io_addr));
 	memset(io_inc, 0, sizeof(io_inc));
@@ -235,6 +325,7 @@ video_reset()
 
 	// init Layer registers
 	memset(reg_layer, 0, sizeof(reg_layer));
+	reset_layer_properties();
 
 	// init composer registers
 	memset(reg_composer, 0, sizeof(reg_composer));
@@ -302,8 +393,16 @@ video_reset()
 	for (int i = 0; i < 128 * 1024; i++) {
 		video_ram[i] = rand();
 	}
+	for (int i = 0; i < 0x200; i++) {
+		video_ram_page_versions[i]++;
+	}
+	memset(tile_row_cache, 0xff, TILE_ROW_CACHE_SIZE * sizeof(*tile_row_cache));
+	if (!headless) {
+		line_cache_epoch++;
+	}
 
 	sprite_line_collisions = 0;
+	sprite_line_key.valid = false;
 
 	vga_scan_pos_x = 0;
 	vga_scan_pos_y = 0;
@@ -325,6 +424,9 @@ video_init(int window_scale, float screen_x_scale, char *quality, bool fullscree
 #endif
 
 	video_reset();
+	if (render_threads) {
+		render_thread_start(render_threads);
+	}
 
 	SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, quality);
 	SDL_SetHint(SDL_HINT_GRAB_KEYBOARD, "1"); // Grabs keyboard shortcuts from the system during window grab
@@ -338,6 +440,11 @@ video_init(int window_scale, float screen_x_scale, char *quality, bool fullscree
 									SDL_PIXELFORMAT_RGB888,
 									SDL_TEXTUREACCESS_STREAMING,
 									SCREEN_WIDTH, SCREEN_HEIGHT);
+	led_texture = SDL_CreateTexture(renderer,
+									SDL_PIXELFORMAT_ARGB8888,
+									SDL_TEXTUREACCESS_STATIC,
+									8, 4);
+	SDL_SetTextureBlendMode(led_texture, SDL_BLENDMODE_BLEND);
 
 	SDL_SetWindowTitle(window, WINDOW_TITLE);
 	SDL_SetWindowIcon(window, CommanderX16Icon());
@@ -371,7 +478,7 @@ video_init(int window_scale, float screen_x_scale, char *quality, bool fullscree
 			// start now
 			record_gif = RECORD_GIF_ACTIVE;
 		}
-		if (!GifBegin(&gif_writer, gif_path, SCREEN_WIDTH, SCREEN_HEIGHT, 1, 8, false)) {
+		if (!gif_recorder_begin(gif_path, SCREEN_WIDTH, SCREEN_HEIGHT)) {
 			record_gif = RECORD_GIF_DISABLED;
 		}
 	}
@@ -426,8 +533,8 @@ struct video_layer_properties
 };
 
 #define NUM_LAYERS 2
-struct video_layer_properties layer_properties[NUM_LAYERS];
-struct video_layer_properties prev_layer_properties[2][NUM_LAYERS];
+machine_local struct video_layer_properties layer_properties[NUM_LAYERS];
+machine_local struct video_layer_properties prev_layer_properties[2][NUM_LAYERS];
 
 static int
 calc_layer_eff_x(const struct video_layer_properties *props, const int x)
@@ -535,6 +642,16 @@ refresh_layer_properties(const uint8_t layer)
 	props->color_fields_max = (8 >> props->color_depth) - 1;
 }
 
+// the layer properties and their history have to match the registers
+static void
+reset_layer_properties()
+{
+	refresh_layer_properties(0);
+	refresh_layer_properties(1);
+	memcpy(prev_layer_properties[0], layer_properties, sizeof(layer_properties));
+	memcpy(prev_layer_properties[1], layer_properties, sizeof(layer_properties));
+}
+
 struct video_sprite_properties
 {
 	int8_t sprite_zdepth;
@@ -557,37 +674,96 @@ struct video_sprite_properties
 };
 
 #ifndef __EMSCRIPTEN__
+struct screenshot {
+	char path[PATH_MAX];
+	uint8_t pixels[SCREEN_WIDTH * SCREEN_HEIGHT * 3];
+};
+
+// The PNG is compressed and written on the recorder thread.
+static void
+write_screenshot(void *data, uint32_t size)
+{
+	(void)size;
+	const struct screenshot *shot = data;
+	if (stbi_write_png(shot->path, SCREEN_WIDTH, SCREEN_HEIGHT, 3, shot->pixels, SCREEN_WIDTH*3)) {
+		printf("Wrote screenshot to %s\n", shot->path);
+	} else {
+		printf("WARNING: Couldn't write screenshot to %s\n", shot->path);
+	}
+}
+
 static void
 screenshot(void)
 {
-	char path[PATH_MAX];
-	const time_t now = time(NULL);
-	strftime(path, PATH_MAX, "x16emu-%Y-%m-%d-%H-%M-%S.png", localtime(&now));
+	struct screenshot *shot = recorder_queue(write_screenshot, sizeof(struct screenshot));
+	if (!shot) {
+		return;
+	}
 
-	memset(png_buffer, 0, SCREEN_WIDTH * SCREEN_HEIGHT * 3);
+	const time_t now = time(NULL);
+	strftime(shot->path, PATH_MAX, "x16emu-%Y-%m-%d-%H-%M-%S.png", localtime(&now));
 
 	// The framebuffer stores pixels in BRGA but we want RGB:
 	for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
-		png_buffer[(i*3)+0] = framebuffer[(i*4)+2];
-		png_buffer[(i*3)+1] = framebuffer[(i*4)+1];
-		png_buffer[(i*3)+2] = framebuffer[(i*4)+0];
+		shot->pixels[(i*3)+0] = framebuffer[(i*4)+2];
+		shot->pixels[(i*3)+1] = framebuffer[(i*4)+1];
+		shot->pixels[(i*3)+2] = framebuffer[(i*4)+0];
 	}
 
-	if (stbi_write_png(path, SCREEN_WIDTH, SCREEN_HEIGHT, 3, png_buffer, SCREEN_WIDTH*3)) {
-		printf("Wrote screenshot to %s\n", path);
-	} else {
-		printf("WARNING: Couldn't write screenshot to %s\n", path);
-	}
+	recorder_submit();
 }
 #endif
 
-struct video_sprite_properties sprite_properties[128];
+machine_local struct video_sprite_properties sprite_properties[128];
+
+// The enabled sprites on every line, one bit per sprite. The effective line
+// can be one past the last visible one.
+#define SPRITE_LINES (SCREEN_HEIGHT + 1)
+static machine_local uint32_t sprite_line_bits[SPRITE_LINES][NUM_SPRITES / 32];
+// counts the changes to the sprite attributes
+static machine_local uint32_t sprite_version;
+
+static void
+update_sprite_line_bits(const uint16_t sprite, bool set)
+{
+	const struct video_sprite_properties *props = &sprite_properties[sprite];
+	const uint32_t bit = 1u << (sprite & 31);
+
+	if (props->sprite_zdepth == 0) {
+		return;
+	}
+
+	int begin = props->sprite_y < 0 ? 0 : props->sprite_y;
+	int end   = props->sprite_y + props->sprite_height;
+	if (end > SPRITE_LINES) {
+		end = SPRITE_LINES;
+	}
+	for (int y = begin; y < end; y++) {
+		if (set) {
+			sprite_line_bits[y][sprite >> 5] |= bit;
+		} else {
+			sprite_line_bits[y][sprite >> 5] &= ~bit;
+		}
+	}
+}
+
+static void
+refresh_sprite_line_bits()
+{
+	memset(sprite_line_bits, 0, sizeof(sprite_line_bits));
+	for (int i = 0; i < NUM_SPRITES; i++) {
+		update_sprite_line_bits(i, true);
+	}
+	sprite_version++;
+}
 
 static void
 refresh_sprite_properties(const uint16_t sprite)
 {
 	struct video_sprite_properties* props = &sprite_properties[sprite];
 
+	update_sprite_line_bits(sprite, false);
+
 	props->sprite_zdepth = (sprite_data[sprite][6] >> 2) & 3;
 	props->sprite_collision_mask = sprite_data[sprite][6] & 0xf0;
 
@@ -613,6 +789,9 @@ refresh_sprite_properties(const uint16_t sprite)
 	props->sprite_address = sprite_data[sprite][0] << 5 | (sprite_data[sprite][1] & 0xf) << 13;
 
 	props->palette_offset = (sprite_data[sprite][7] & 0x0f) << 4;
+
+	update_sprite_line_bits(sprite, true);
+	sprite_version++;
 }
 
 struct video_palette
@@ -621,10 +800,13 @@ struct video_palette
 	bool dirty;
 };
 
-struct video_palette video_palette;
+machine_local struct video_palette video_palette;
+// counts the changes of the palette entries
+static machine_local uint32_t palette_version;
 
 static void
 refresh_palette() {
+	uint32_t entries[256];
 	const uint8_t out_mode = reg_composer[0] & 3;
 	const bool chroma_disable = ((reg_composer[0] & 0x07) == 6);
 	for (int i = 0; i < 256; ++i) {
@@ -647,11 +829,29 @@ refresh_palette() {
 			}
 		}
 
-		video_palette.entries[i] = (uint32_t)(r << 16) | ((uint32_t)g << 8) | ((uint32_t)b);
+		entries[i] = (uint32_t)(r << 16) | ((uint32_t)g << 8) | ((uint32_t)b);
 	}
 	video_palette.dirty = false;
+	// any DC_VIDEO write gets here, which mostly leaves the colors alone
+	if (memcmp(video_palette.entries, entries, sizeof(entries))) {
+		memcpy(video_palette.entries, entries, sizeof(entries));
+		palette_version++;
+	}
 }
 
+// The palettes the lines have been drawn with since their color indices
+// were last looked up, usually just one.
+#define FRAME_PALETTES 128
+
+struct frame_palette {
+	uint32_t entries[256];
+	uint32_t version;
+	bool     overscan; // NTSC, with the overscan area dimmed
+};
+
+static struct frame_palette frame_palettes[FRAME_PALETTES];
+static int frame_palette_count;
+
 static void
 expand_4bpp_data(uint8_t *dst, const uint8_t *src, int dst_size)
 {
@@ -666,34 +866,85 @@ expand_4bpp_data(uint8_t *dst, const uint8_t *src, int dst_size)
 	}
 }
 
+// the VRAM pages the line being rendered reads, one bit per page
+static machine_local uint32_t line_pages[0x200 / 32];
+
+static void
+mark_page_read(uint32_t address)
+{
+	const uint32_t page = (address & 0x1FFFF) >> 8;
+	line_pages[page >> 5] |= 1u << (page & 31);
+}
+
+static void
+mark_pages_read(uint32_t address, uint32_t size)
+{
+	const uint32_t first = (address & 0x1FFFF) >> 8;
+	const uint32_t last  = ((address + size - 1) & 0x1FFFF) >> 8;
+	for (uint32_t page = first;; page = (page + 1) & 0x1FF) {
+		line_pages[page >> 5] |= 1u << (page & 31);
+		if (page == last) {
+			break;
+		}
+	}
+}
+
 static void
 render_sprite_line(const uint16_t y)
 {
-	memset(sprite_line_col, 0, SCREEN_WIDTH);
-	memset(sprite_line_z, 0, SCREEN_WIDTH);
-	memset(sprite_line_mask, 0, SCREEN_WIDTH);
+	if (sprite_line_dirty_begin < sprite_line_dirty_end) {
+		const uint16_t size = sprite_line_dirty_end - sprite_line_dirty_begin;
+		memset(&sprite_line_col[sprite_line_dirty_begin], 0, size);
+		memset(&sprite_line_z[sprite_line_dirty_begin], 0, size);
+		memset(&sprite_line_mask[sprite_line_dirty_begin], 0, size);
+	}
+	sprite_line_dirty_begin = SCREEN_WIDTH;
+	sprite_line_dirty_end = 0;
 
 	uint16_t sprite_budget = 800 + 1;
+	int      lookups       = 0;
 	for (int i = 0; i < NUM_SPRITES; i++) {
-		// one clock per lookup
-		sprite_budget--; if (sprite_budget == 0) break;
-		const struct video_sprite_properties *props = &sprite_properties[i];
-
-		if (props->sprite_zdepth == 0) {
+		if (!(i & 31) && !sprite_line_bits[y][i >> 5]) {
+			i += 31;
 			continue;
 		}
-
-		// check whether this line falls within the sprite
-		if (y < props->sprite_y || y >= props->sprite_y + props->sprite_height) {
+		if (!(sprite_line_bits[y][i >> 5] & (1u << (i & 31)))) {
 			continue;
 		}
 
+		// one clock per lookup, including the sprites not on this line
+		for (; lookups <= i; lookups++) {
+			if (--sprite_budget == 0) break;
+		}
+		if (sprite_budget == 0) break;
+		const struct video_sprite_properties *props = &sprite_properties[i];
+
+		const int dirty_begin = props->sprite_x < 0 ? 0 : props->sprite_x;
+		const int dirty_end   = props->sprite_x + props->sprite_width;
+		if (dirty_begin < sprite_line_dirty_begin) {
+			sprite_line_dirty_begin = dirty_begin;
+		}
+		if (dirty_end > sprite_line_dirty_end) {
+			sprite_line_dirty_end = dirty_end < SCREEN_WIDTH ? dirty_end : SCREEN_WIDTH;
+		}
+
 		const uint16_t eff_sy = props->vflip ? ((props->sprite_height - 1) - (y - props->sprite_y)) : (y - props->sprite_y);
 
 		int16_t       eff_sx      = (props->hflip ? (props->sprite_width - 1) : 0);
 		const int16_t eff_sx_incr = props->hflip ? -1 : 1;
 
-		const uint8_t *bitmap_data = video_ram + props->sprite_address + (eff_sy << (props->sprite_width_log2 - (1 - props->color_mode)));
+		const uint32_t address = props->sprite_address + (eff_sy << (props->sprite_width_log2 - (1 - props->color_mode)));
+		const uint16_t bytes = props->sprite_width >> (1 - props->color_mode);
+		const uint8_t *bitmap_data = video_ram + address;
+		uint8_t wrapped_data[64];
+		if (address + bytes > VIDEO_RAM_SIZE) {
+			// the line wraps around the end of VRAM
+			for (int j = 0; j < bytes; j++) {
+				wrapped_data[j] = video_ram[(address + j) & (VIDEO_RAM_SIZE - 1)];
+			}
+			bitmap_data = wrapped_data;
+		}
+		mark_pages_read(address, bytes);
 
 		uint8_t unpacked_sprite_line[64];
 		const uint16_t width = (props->sprite_width<64? props->sprite_width : 64);
@@ -741,13 +992,26 @@ render_sprite_line(const uint16_t y)
 	}
 }
 
+// Every bit of a 1 bpp glyph byte expanded into a byte mask, leftmost pixel
+// first, so that a character row is a select between background and
+// foreground color.
+#define GLYPH_MASK(b) { \
+	(b) & 0x80 ? 0xff : 0, (b) & 0x40 ? 0xff : 0, (b) & 0x20 ? 0xff : 0, (b) & 0x10 ? 0xff : 0, \
+	(b) & 0x08 ? 0xff : 0, (b) & 0x04 ? 0xff : 0, (b) & 0x02 ? 0xff : 0, (b) & 0x01 ? 0xff : 0 }
+#define GLYPH_MASK4(b)  GLYPH_MASK(b), GLYPH_MASK((b) + 1), GLYPH_MASK((b) + 2), GLYPH_MASK((b) + 3)
+#define GLYPH_MASK16(b) GLYPH_MASK4(b), GLYPH_MASK4((b) + 4), GLYPH_MASK4((b) + 8), GLYPH_MASK4((b) + 12)
+#define GLYPH_MASK64(b) GLYPH_MASK16(b), GLYPH_MASK16((b) + 16), GLYPH_MASK16((b) + 32), GLYPH_MASK16((b) + 48)
+
+static const uint8_t glyph_masks[256][8] = {
+	GLYPH_MASK64(0), GLYPH_MASK64(64), GLYPH_MASK64(128), GLYPH_MASK64(192)
+};
+
 static void
-render_layer_line_text(uint8_t layer, uint16_t y)
+render_layer_line_text(uint8_t layer, uint16_t y, uint16_t x_begin, uint16_t x_end)
 {
 	const struct video_layer_properties *props = &prev_layer_properties[1][layer];
 	const struct video_layer_properties *props0 = &prev_layer_properties[0][layer];
 
-	const uint8_t max_pixels_per_byte = (8 >> props->color_depth) - 1;
 	const int     eff_y               = calc_layer_eff_y(props0, y);
 	const int     yy                  = eff_y & props->tileh_max;
 
@@ -760,24 +1024,21 @@ render_layer_line_text(uint8_t layer, uint16_t y)
 
 	uint8_t tile_bytes[512]; // max 256 tiles, 2 bytes each.
 	video_space_read_range(tile_bytes, map_addr_begin, size);
+	mark_pages_read(map_addr_begin, size);
 
-	uint32_t tile_start;
-
-	uint8_t  fg_color;
-	uint8_t  bg_color;
-	uint8_t  s;
-	uint8_t  color_shift;
-
-	{
-		const int eff_x = calc_layer_eff_x(props, 0);
-		const int xx    = eff_x & props->tilew_max;
+	uint8_t row[16];
+	int     eff_x = calc_layer_eff_x(props, x_begin);
 
+	// Render tile line, one character row at a time.
+	for (int x = x_begin; x < x_end;) {
 		// extract all information from the map
 		const uint32_t map_addr = calc_layer_map_addr_base2(props, eff_x, eff_y) - map_addr_begin;
 
 		const uint8_t tile_index = tile_bytes[map_addr];
 		const uint8_t byte1      = tile_bytes[map_addr + 1];
 
+		uint8_t fg_color;
+		uint8_t bg_color;
 		if (!props->text_mode_256c) {
 			fg_color = byte1 & 15;
 			bg_color = byte1 >> 4;
@@ -785,66 +1046,116 @@ render_layer_line_text(uint8_t layer, uint16_t y)
 			fg_color = byte1;
 			bg_color = 0;
 		}
+		const uint8_t diff = fg_color ^ bg_color;
 
 		// offset within tilemap of the current tile
-		tile_start = tile_index << props->tile_size_log2;
+		const uint32_t tile_start = tile_index << props->tile_size_log2;
+
+		// a character row never crosses a page
+		mark_page_read(props->tile_base + tile_start + y_add);
+		for (int b = 0; b < props->tilew >> 3; b++) {
+			const uint8_t *mask = glyph_masks[video_space_read(props->tile_base + tile_start + y_add + b)];
+			for (int i = 0; i < 8; i++) {
+				row[b * 8 + i] = bg_color ^ (diff & mask[i]);
+			}
+		}
 
-		// additional bytes to reach the correct column of the tile
-		const uint16_t x_add       = xx >> 3;
-		const uint32_t tile_offset = tile_start + y_add + x_add;
+		// the first and the last character may be cut off
+		const int xx = eff_x & props->tilew_max;
+		int count = props->tilew - xx;
+		if (count > x_end - x) {
+			count = x_end - x;
+		}
+		memcpy(&layer_line[layer][x], &row[xx], count);
 
-		s           = video_space_read(props->tile_base + tile_offset);
-		color_shift = max_pixels_per_byte - (xx & 0x7);
+		x += count;
+		eff_x = (eff_x + count) & props->layerw_max;
 	}
+}
 
-	// Render tile line.
-	for (int x = 0; x < SCREEN_WIDTH; x++) {
-		// Scrolling
-		const int eff_x = calc_layer_eff_x(props, x);
-		const int xx = eff_x & props->tilew_max;
+// Unpack pixels of 1, 2, 4 or 8 bpp into one byte each. There is a simple
+// loop per color depth, so the compiler can turn them into vector code.
+static void
+expand_pixels(uint8_t *dst, const uint8_t *src, int count, uint8_t color_depth)
+{
+	switch (color_depth) {
+		case 0:
+			for (int i = 0; i < count; i++) {
+				dst[i] = (src[i >> 3] >> (7 - (i & 7))) & 1;
+			}
+			break;
+		case 1:
+			for (int i = 0; i < count; i++) {
+				dst[i] = (src[i >> 2] >> (6 - ((i & 3) << 1))) & 3;
+			}
+			break;
+		case 2:
+			for (int i = 0; i < count; i++) {
+				dst[i] = (src[i >> 1] >> ((~i & 1) << 2)) & 15;
+			}
+			break;
+		default:
+			memcpy(dst, src, count);
+			break;
+	}
+}
 
-		if ((eff_x & 0x7) == 0) {
-			if ((eff_x & props->tilew_max) == 0) {
-				// extract all information from the map
-				const uint32_t map_addr = calc_layer_map_addr_base2(props, eff_x, eff_y) - map_addr_begin;
+// Colors 1 to 15 are moved to the palette offset's block of 16
+static void
+apply_palette_offset(uint8_t *row, int count, uint8_t palette_offset, bool text_mode_256c)
+{
+	if (palette_offset || text_mode_256c) {
+		const uint8_t high = text_mode_256c ? 0x80 : 0;
+		for (int i = 0; i < count; i++) {
+			const uint8_t c = row[i];
+			row[i] = (c > 0 && c < 16) ? (c + palette_offset) | high : c;
+		}
+	}
+}
 
-				const uint8_t tile_index = tile_bytes[map_addr];
-				const uint8_t byte1      = tile_bytes[map_addr + 1];
+// Decode one row of a tile into indexed colors, a whole tile row at a time.
+static const uint8_t *
+tile_row_pixels(uint32_t address, const struct video_layer_properties *props)
+{
+	const int      bytes_log2 = props->tilew_log2 + props->color_depth - 3;
+	const uint32_t key        = address | props->color_depth << 17 | props->tilew_log2 << 19;
+	const uint32_t version    = video_ram_page_versions[address >> 8];
 
-				if (!props->text_mode_256c) {
-					fg_color = byte1 & 15;
-					bg_color = byte1 >> 4;
-				} else {
-					fg_color = byte1;
-					bg_color = 0;
-				}
+	struct tile_row_cache_entry *entry = &tile_row_cache[(address >> bytes_log2) & (TILE_ROW_CACHE_SIZE - 1)];
+	if (entry->key == key && entry->version == version) {
+		return entry->pixels;
+	}
+	entry->key     = key;
+	entry->version = version;
 
-				// offset within tilemap of the current tile
-				tile_start = tile_index << props->tile_size_log2;
-			}
+	expand_pixels(entry->pixels, &video_ram[address], props->tilew, props->color_depth);
+	return entry->pixels;
+}
 
-			// additional bytes to reach the correct column of the tile
-			const uint16_t x_add       = xx >> 3;
-			const uint32_t tile_offset = tile_start + y_add + x_add;
+static void
+decode_tile_row(uint8_t *row, uint32_t address, const struct video_layer_properties *props, bool hflip, uint8_t palette_offset)
+{
+	const int      tilew  = props->tilew;
+	const uint8_t *pixels = tile_row_pixels(address, props);
+	mark_page_read(address);
 
-			s           = video_space_read(props->tile_base + tile_offset);
-			color_shift = max_pixels_per_byte;
+	if (hflip) {
+		for (int i = 0; i < tilew; i++) {
+			row[i] = pixels[tilew - 1 - i];
 		}
-
-		// convert tile byte to indexed color
-		const uint8_t col_index = (s >> color_shift) & 1;
-		--color_shift;
-		layer_line[layer][x] = col_index ? fg_color : bg_color;
+	} else {
+		memcpy(row, pixels, tilew);
 	}
+
+	apply_palette_offset(row, tilew, palette_offset, props->text_mode_256c);
 }
 
 static void
-render_layer_line_tile(uint8_t layer, uint16_t y)
+render_layer_line_tile(uint8_t layer, uint16_t y, uint16_t x_begin, uint16_t x_end)
 {
 	const struct video_layer_properties *props = &prev_layer_properties[1][layer];
 	const struct video_layer_properties *props0 = &prev_layer_properties[0][layer];
 
-	const uint8_t max_pixels_per_byte = (8 >> props->color_depth) - 1;
 	const int     eff_y               = calc_layer_eff_y(props0, y);
 	const uint8_t yy                  = eff_y & props->tileh_max;
 	const uint8_t yy_flip             = yy ^ props->tileh_max;
@@ -857,18 +1168,13 @@ render_layer_line_tile(uint8_t layer, uint16_t y)
 
 	uint8_t tile_bytes[512]; // max 256 tiles, 2 bytes each.
 	video_space_read_range(tile_bytes, map_addr_begin, size);
+	mark_pages_read(map_addr_begin, size);
 
-	uint8_t  palette_offset;
-	bool     vflip;
-	bool     hflip;
-	uint32_t tile_start;
-	uint8_t  s;
-	uint8_t  color_shift;
-	int8_t   color_shift_incr;
-
-	{
-		const int eff_x = calc_layer_eff_x(props, 0);
+	uint8_t row[16];
+	int     eff_x = calc_layer_eff_x(props, x_begin);
 
+	// Render tile line, one tile row at a time.
+	for (int x = x_begin; x < x_end;) {
 		// extract all information from the map
 		const uint32_t map_addr = calc_layer_map_addr_base2(props, eff_x, eff_y) - map_addr_begin;
 
@@ -876,155 +1182,903 @@ render_layer_line_tile(uint8_t layer, uint16_t y)
 		const uint8_t byte1 = tile_bytes[map_addr + 1];
 
 		// Tile Flipping
-		vflip = (byte1 >> 3) & 1;
-		hflip = (byte1 >> 2) & 1;
+		const bool vflip = (byte1 >> 3) & 1;
+		const bool hflip = (byte1 >> 2) & 1;
 
-		palette_offset = byte1 & 0xf0;
+		const uint8_t palette_offset = byte1 & 0xf0;
 
 		// offset within tilemap of the current tile
 		const uint16_t tile_index = byte0 | ((byte1 & 3) << 8);
-		tile_start                = tile_index << props->tile_size_log2;
+		const uint32_t tile_start = tile_index << props->tile_size_log2;
 
-		color_shift_incr = hflip ? props->bits_per_pixel : -props->bits_per_pixel;
+		decode_tile_row(row, (props->tile_base + tile_start + (vflip ? y_add_flip : y_add)) & 0x1FFFF, props, hflip, palette_offset);
 
-		int xx = eff_x & props->tilew_max;
-		if (hflip) {
-			xx          = xx ^ (props->tilew_max);
-			color_shift = 0;
-		} else {
-			color_shift = props->first_color_pos;
+		// the first and the last tile may be cut off
+		const int xx = eff_x & props->tilew_max;
+		int count = props->tilew - xx;
+		if (count > x_end - x) {
+			count = x_end - x;
 		}
+		memcpy(&layer_line[layer][x], &row[xx], count);
+
+		x += count;
+		eff_x = (eff_x + count) & props->layerw_max;
+	}
+}
+
+
+static void
+render_layer_line_bitmap(uint8_t layer, uint16_t y, uint16_t x_begin, uint16_t x_end)
+{
+	const struct video_layer_properties *props = &prev_layer_properties[1][layer];
+//	const struct video_layer_properties *props0 = &prev_layer_properties[0][layer];
 
-		// additional bytes to reach the correct column of the tile
-		uint16_t x_add       = (xx << props->color_depth) >> 3;
-		uint32_t tile_offset = tile_start + (vflip ? y_add_flip : y_add) + x_add;
+	const int      yy        = y % props->tileh;
+	const int      num_bytes = (props->tilew << props->color_depth) >> 3;
+	// additional bytes to reach the correct line of the tile
+	const uint32_t y_add     = yy * num_bytes;
+
+	const uint8_t palette_offset = (reg_layer[layer][4] & 0xf) << 4;
+
+	// A 320 pixel wide bitmap repeats. The pixels are decoded from the
+	// first one of their byte, 8 pixels back at most.
+	for (int x = x_begin; x < x_end;) {
+		const int bx    = x % props->tilew;
+		const int count = MIN(x_end - x, props->tilew - bx);
+		const int first = bx & ~7;
+		const int total = bx + count - first;
+
+		const uint32_t address = props->tile_base + y_add + ((first << props->color_depth) >> 3);
+		const int      size    = ((total << props->color_depth) + 7) >> 3;
+
+		uint8_t bytes[SCREEN_WIDTH];
+		uint8_t pixels[SCREEN_WIDTH];
+		video_space_read_range(bytes, address & 0x1FFFF, size);
+		mark_pages_read(address, size);
+		expand_pixels(pixels, bytes, total, props->color_depth);
+		apply_palette_offset(&pixels[bx - first], count, palette_offset, props->text_mode_256c);
+		memcpy(&layer_line[layer][x], &pixels[bx - first], count);
+		x += count;
+	}
+}
 
-		s = video_space_read(props->tile_base + tile_offset);
+// Resolve the priorities of the sprites and layers over a range of the line.
+// The sprite's z-depth puts it in front of both layers (3), between them (2)
+// or behind them (1). Written as selects, so the compiler can vectorize it.
+static void
+compose_line(uint8_t *dst, int begin, int end)
+{
+	for (int x = begin; x < end; x++) {
+		const uint8_t z  = sprite_line_z[x];
+		const uint8_t s  = sprite_line_col[x];
+		const uint8_t l1 = layer_line[0][x];
+		const uint8_t l2 = layer_line[1][x];
+
+		const uint8_t layers = l2 ? l2 : l1;
+		uint8_t col = layers;
+		col = (z == 3 && s) ? s : col;
+		col = (z == 2 && !l2 && s) ? s : col;
+		col = (z == 1 && !layers) ? s : col;
+		dst[x] = col;
 	}
+}
 
+// The NTSC overscan area outside the title safe area is dimmed.
+#define TITLE_SAFE_LEFT   ((int)ceil(SCREEN_WIDTH * TITLE_SAFE_X))
+#define TITLE_SAFE_RIGHT  ((int)floor(SCREEN_WIDTH * (1 - TITLE_SAFE_X)) + 1)
+#define TITLE_SAFE_TOP    ((int)ceil(SCREEN_HEIGHT * TITLE_SAFE_Y))
+#define TITLE_SAFE_BOTTOM ((int)floor(SCREEN_HEIGHT * (1 - TITLE_SAFE_Y)) + 1)
+
+static void
+dim_pixels(uint32_t *framebuffer4, int begin, int end)
+{
+	for (int x = begin; x < end; x++) {
+		// Divide RGB elements by 4.
+		framebuffer4[x] = (framebuffer4[x] & 0x00fcfcfc) >> 2;
+	}
+}
 
-	// Render tile line.
-	for (int x = 0; x < SCREEN_WIDTH; x++) {
-		const int eff_x = calc_layer_eff_x(props, x);
+// The lines are drawn as color indices, which are only looked up in their
+// palette when the frame is shown.
+static uint8_t framebuffer_indices[SCREEN_WIDTH * SCREEN_HEIGHT];
 
-		if ((eff_x & max_pixels_per_byte) == 0) {
-			if ((eff_x & props->tilew_max) == 0) {
-				// extract all information from the map
-				const uint32_t map_addr = calc_layer_map_addr_base2(props, eff_x, eff_y) - map_addr_begin;
+// the columns of a row that have been drawn since their colors were looked
+// up, all with the same palette
+struct row_colors {
+	uint16_t begin;
+	uint16_t end;
+	uint8_t  palette; // into frame_palettes
+};
 
-				const uint8_t byte0 = tile_bytes[map_addr];
-				const uint8_t byte1 = tile_bytes[map_addr + 1];
+static struct row_colors drawn_rows[SCREEN_HEIGHT];
 
-				// Tile Flipping
-				vflip = (byte1 >> 3) & 1;
-				hflip = (byte1 >> 2) & 1;
+// the palette version all colors of a row have been looked up in, plus one,
+// or 0 if there has been more than one or they have been dimmed
+static uint32_t row_palette_versions[SCREEN_HEIGHT];
 
-				palette_offset = byte1 & 0xf0;
+static void
+look_up_row(uint16_t y)
+{
+	struct row_colors *row = &drawn_rows[y];
+	const struct frame_palette *palette = &frame_palettes[row->palette];
+	const uint8_t *indices = &framebuffer_indices[y * SCREEN_WIDTH];
+	uint32_t *framebuffer4 = ((uint32_t *)framebuffer) + (y * SCREEN_WIDTH);
 
-				// offset within tilemap of the current tile
-				const uint16_t tile_index = byte0 | ((byte1 & 3) << 8);
-				tile_start                = tile_index << props->tile_size_log2;
+	const uint32_t version = palette->overscan ? 0 : palette->version + 1;
+	const bool whole_row = row->begin == 0 && row->end == SCREEN_WIDTH;
+	row_palette_versions[y] = whole_row || row_palette_versions[y] == version ? version : 0;
 
-				color_shift_incr = hflip ? props->bits_per_pixel : -props->bits_per_pixel;
-			}
+	for (uint16_t x = row->begin; x < row->end; x++) {
+		framebuffer4[x] = palette->entries[indices[x]];
+	}
+	if (palette->overscan) {
+		if (y < TITLE_SAFE_TOP || y >= TITLE_SAFE_BOTTOM) {
+			dim_pixels(framebuffer4, row->begin, row->end);
+		} else {
+			dim_pixels(framebuffer4, row->begin, MIN(row->end, TITLE_SAFE_LEFT));
+			dim_pixels(framebuffer4, MAX(row->begin, TITLE_SAFE_RIGHT), row->end);
+		}
+	}
+	row->begin = row->end = 0;
+}
 
-			int xx = eff_x & props->tilew_max;
-			if (hflip) {
-				xx = xx ^ (props->tilew_max);
-				color_shift = 0;
-			} else {
-				color_shift = props->first_color_pos;
+// after the render threads are done
+static void
+look_up_rows()
+{
+	for (uint16_t y = 0; y < SCREEN_HEIGHT; y++) {
+		if (drawn_rows[y].begin < drawn_rows[y].end) {
+			look_up_row(y);
+		}
+	}
+	frame_palette_count = 0;
+}
+
+// Returns the frame palette of the lines drawn from now on.
+static uint8_t
+current_frame_palette()
+{
+	const bool overscan = (reg_composer[0] & 3) == 2;
+	if (frame_palette_count) {
+		const struct frame_palette *last = &frame_palettes[frame_palette_count - 1];
+		if (last->version == palette_version && last->overscan == overscan) {
+			return frame_palette_count - 1;
+		}
+	}
+	if (frame_palette_count == FRAME_PALETTES) {
+		render_thread_sync();
+		look_up_rows();
+	}
+	struct frame_palette *palette = &frame_palettes[frame_palette_count];
+	memcpy(palette->entries, video_palette.entries, sizeof(palette->entries));
+	palette->version = palette_version;
+	palette->overscan = overscan;
+	return frame_palette_count++;
+}
+
+// render_line() progress, kept between the partial lines of midline effects
+static machine_local uint16_t y_prev;
+static machine_local uint16_t s_pos_x_p;
+static machine_local uint32_t eff_y_fp; // 16.16 fixed point
+static machine_local uint32_t eff_x_fp; // 16.16 fixed point
+static machine_local uint8_t col_line[SCREEN_WIDTH];
+
+// A line that is rendered in one go is remembered together with everything
+// it depends on, so that it can be left in the framebuffer the next frame if
+// none of it has changed.
+struct line_cache_key {
+	struct video_layer_properties layer_properties[2][NUM_LAYERS];
+	uint8_t  reg_composer[8]; // DCSEL 0 and 1
+	uint8_t  reg_layer[2][7];
+	uint16_t eff_y;
+	uint32_t palette_version;
+	uint32_t sprite_version;
+	uint32_t epoch;
+};
+
+struct line_cache_entry {
+	bool     valid;
+	struct line_cache_key key;
+	uint32_t pages[0x200 / 32]; // the VRAM pages the line has read
+	uint32_t page_versions;     // the sum of their write counters
+};
+
+static struct line_cache_entry line_cache[SCREEN_HEIGHT];
+
+static uint32_t
+sum_page_versions(const uint32_t *pages)
+{
+	uint32_t sum = 0;
+	for (int i = 0; i < 0x200 / 32; i++) {
+		uint32_t page = i * 32;
+		for (uint32_t bits = pages[i]; bits; bits >>= 1, page++) {
+			if (bits & 1) {
+				sum += video_ram_page_versions[page];
 			}
+		}
+	}
+	return sum;
+}
+
+// The part of a line that render_line() leaves to draw_line()
+struct line_span {
+	uint16_t y;
+	uint16_t x_begin;
+	uint16_t x_end;
+	uint16_t eff_y;
+	uint32_t eff_x_fp;            // 16.16 fixed point
+	uint16_t layer_begin;         // the columns of the layers that are shown
+	uint16_t layer_end;
+	bool     composes;            // false for the border and with video output off
+	uint8_t  palette;             // into frame_palettes
+	uint16_t layer_clear_from[2]; // SCREEN_WIDTH if not cleared
+	bool     cached;              // the framebuffer already has this line
+	struct line_cache_key key;    // of a whole line
+};
+
+// Draws a part of a line into the framebuffer: the layers and the composer.
+// Of the VERA state, it only reads the registers, the layer properties, the
+// sprite line and VRAM, so that another thread can run it on a copy of
+// them. Returns whether it has drawn.
+static bool
+draw_line(const struct line_span *span)
+{
+	const uint16_t y           = span->y;
+	const uint16_t x_begin     = span->x_begin;
+	const uint16_t x_end       = span->x_end;
+	const uint16_t eff_y       = span->eff_y;
+	const uint16_t layer_begin = span->layer_begin;
+	const uint16_t layer_end   = span->layer_end;
+	uint32_t       x_fp        = span->eff_x_fp;
+
+	uint8_t out_mode = reg_composer[0] & 3;
 
-			// additional bytes to reach the correct column of the tile
-			const uint16_t x_add       = (xx << props->color_depth) >> 3;
-			const uint32_t tile_offset = tile_start + (vflip ? y_add_flip : y_add) + x_add;
+	uint8_t border_color = reg_composer[3];
+	uint16_t hstart = MIN(reg_composer[4] << 2, SCREEN_WIDTH);
+	uint16_t hstop = MIN(reg_composer[5] << 2, SCREEN_WIDTH);
+	uint16_t vstart = reg_composer[6] << 1;
+	uint16_t vstop = reg_composer[7] << 1;
 
-			s = video_space_read(props->tile_base + tile_offset);
+	for (uint8_t layer = 0; layer < 2; layer++) {
+		const uint16_t from = span->layer_clear_from[layer];
+		memset(&layer_line[layer][from], 0, SCREEN_WIDTH - from);
+	}
+
+	const bool full_line = x_begin == 0 && x_end == SCREEN_WIDTH;
+	if (!full_line) {
+		line_cache[y].valid = false;
+	} else if (span->cached) {
+		// as if the line had been drawn again
+		memcpy(col_line, &framebuffer_indices[y * SCREEN_WIDTH], SCREEN_WIDTH);
+		return false;
+	}
+
+	for (uint8_t layer = 0; layer < 2; layer++) {
+		if (!layer_line_enable[layer] || layer_begin == layer_end) {
+			continue;
 		}
+		if (prev_layer_properties[1][layer].text_mode) {
+			render_layer_line_text(layer, eff_y, layer_begin, layer_end);
+		} else if (prev_layer_properties[1][layer].bitmap_mode) {
+			render_layer_line_bitmap(layer, eff_y, layer_begin, layer_end);
+		} else {
+			render_layer_line_tile(layer, eff_y, layer_begin, layer_end);
+		}
+	}
 
-		// convert tile byte to indexed color
-		uint8_t col_index = (s >> color_shift) & props->color_mask;
-		color_shift += color_shift_incr;
+	// If video output is enabled, calculate color indices for line.
+	if (out_mode != 0) {
+		// Add border after if required.
+		if (y < vstart || y >= vstop) {
+			uint32_t border_fill = border_color;
+			border_fill = border_fill | (border_fill << 8);
+			border_fill = border_fill | (border_fill << 16);
+			memset(col_line, border_fill, SCREEN_WIDTH);
+		} else {
+			for (uint16_t x = x_begin; x < hstart && x < x_end; ++x) {
+				col_line[x] = border_color;
+			}
 
-		// Apply Palette Offset
-		if (col_index > 0 && col_index < 16) {
-			col_index += palette_offset;
-			if (props->text_mode_256c) {
-				col_index |= 0x80;
+			if (span->composes) {
+				const uint32_t scale   = reg_composer[1];
+				const uint16_t begin   = MAX(hstart, x_begin);
+				const uint16_t end     = MIN(hstop, x_end);
+				const uint32_t first_x = x_fp >> 16;
+
+				// merge only the part of the layers that HSCALE maps to
+				uint8_t composed[SCREEN_WIDTH];
+				compose_line(composed, layer_begin, layer_end);
+
+				if (scale == 128 && !(x_fp & 0xffff)) {
+					// 1:1
+					const uint16_t count   = end - begin;
+					const uint16_t visible = first_x < SCREEN_WIDTH ? MIN(count, SCREEN_WIDTH - first_x) : 0;
+					memcpy(&col_line[begin], &composed[first_x], visible);
+					memset(&col_line[begin + visible], 0, count - visible);
+				} else {
+					for (uint16_t x = begin; x < end; ++x) {
+						uint16_t eff_x = x_fp >> 16;
+						col_line[x] = (eff_x < SCREEN_WIDTH) ? composed[eff_x] : 0;
+						x_fp += (scale << 9);
+					}
+				}
+			}
+			for (uint16_t x = hstop; x < x_end; ++x) {
+				col_line[x] = border_color;
 			}
 		}
-		layer_line[layer][x] = col_index;
 	}
+
+	memcpy(&framebuffer_indices[y * SCREEN_WIDTH + x_begin], &col_line[x_begin], x_end - x_begin);
+
+	// a row only waits for one palette
+	struct row_colors *row = &drawn_rows[y];
+	if (row->begin < row->end && row->palette != span->palette) {
+		look_up_row(y);
+	}
+	if (row->begin < row->end) {
+		row->begin = MIN(row->begin, x_begin);
+		row->end = MAX(row->end, x_end);
+	} else {
+		row->begin = x_begin;
+		row->end = x_end;
+		row->palette = span->palette;
+	}
+
+	if (full_line) {
+		struct line_cache_entry *cached_line = &line_cache[y];
+		cached_line->valid = true;
+		cached_line->key = span->key;
+		memcpy(cached_line->pages, line_pages, sizeof(line_pages));
+		cached_line->page_versions = sum_page_versions(line_pages);
+	}
+	return true;
 }
 
+// With -render-threads, draw_line() runs on threads of their own. They keep
+// a copy of the parts of the VERA state that it reads in their own
+// machine_local variables. The lines of a frame are collected in a batch,
+// and every line carries the registers, the layer properties and the sprite
+// line. The VRAM pages whose write counters have moved since the line
+// before go into the page journal, and the palette comes along when its
+// version has moved.
+//
+// A single render thread draws the lines as they come in. With more, the
+// batch is split into bands at the end of the frame, which the threads draw
+// in parallel. Every thread goes through all lines of the batch for the VRAM
+// pages and the palette, but only draws those of its band.
+//
+// The lines of a band depend on the lines before it through the layer
+// lines: a disabled layer keeps what was last left in its layer line. So a
+// band only starts at a line from where on no line reads what was written
+// before it, and the first band starts from the layer lines as the batch
+// before has left them.
+//
+// The framebuffer and the line cache belong to the render threads until
+// render_thread_sync() has seen the batch drawn.
+#ifdef MACHINE_LOCAL_PER_THREAD
+#define RENDER_BATCH_LINES   1024
+#define RENDER_JOURNAL_PAGES 2048
+
+struct render_job {
+	struct line_span span;
+	uint8_t  reg_composer[8];
+	uint8_t  reg_layer[2][7];
+	struct video_layer_properties layer_properties[2][NUM_LAYERS];
+	bool     layer_line_enable[2];
+	uint8_t  sprite_line_col[SCREEN_WIDTH];
+	uint8_t  sprite_line_z[SCREEN_WIDTH];
+	uint32_t line_pages[0x200 / 32];
+	bool     has_layer_lines; // and col_line, after a state load
+	uint32_t journal_begin;   // the VRAM pages that have changed before it
+	uint32_t journal_end;
+	int32_t  needs;           // the first line of the batch whose layer line columns it reads
+};
+
+struct journal_page {
+	uint16_t page;
+	uint32_t version;
+	uint8_t  data[256];
+};
 
+struct render_worker {
+	pthread_t thread;
+	uint8_t   *video_ram;
+	struct tile_row_cache_entry *tile_row_cache;
+	uint32_t  band_begin;
+	uint32_t  band_end;
+	uint8_t   layer_line[2][SCREEN_WIDTH]; // as the band has left them
+	uint8_t   col_line[SCREEN_WIDTH];
+	struct row_range drew;
+};
+
+// this machine's lines go to the render threads
+static machine_local bool render_thread_active;
+
+static int render_thread_count;
+static struct render_worker render_workers[RENDER_MAX_THREADS];
+static bool render_thread_quit;
+static pthread_mutex_t render_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t render_queued = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t render_done = PTHREAD_COND_INITIALIZER;
+
+static struct render_job *render_jobs;
+static struct journal_page *render_journal;
+static uint32_t render_jobs_count;    // only moved by the CPU thread
+static uint32_t render_journal_count;
+static uint32_t render_batch = 1;
+static uint32_t render_batch_of_line[SCREEN_HEIGHT]; // the last batch a line was drawn in
+static uint32_t render_jobs_done;     // by the single render thread
+static uint32_t render_generation;    // of the batch the bands are drawn of
+static int render_bands_done;
+static uint32_t render_stat_batches;
+static uint32_t render_stat_bands;
+
+// the layer lines and col_line at the start of the batch
+static uint8_t render_layer_line[2][SCREEN_WIDTH];
+static uint8_t render_col_line[SCREEN_WIDTH];
+// asks the single render thread to leave its lines there once it is idle
+static bool render_fetch;
+// the line of the batch that has last written a layer line column, or -1
+static int16_t layer_line_writer[2][SCREEN_WIDTH];
+
+// what the render threads have been sent so far
+static uint32_t sent_page_versions[0x200];
+static bool render_resync;
+
+// Follow the layer line columns the line writes and reads, as draw_line()
+// does, to find out which lines it depends on.
 static void
-render_layer_line_bitmap(uint8_t layer, uint16_t y)
+track_layer_lines(struct render_job *job, int16_t index)
 {
-	const struct video_layer_properties *props = &prev_layer_properties[1][layer];
-//	const struct video_layer_properties *props0 = &prev_layer_properties[0][layer];
+	const struct line_span *span = &job->span;
 
-	int yy = y % props->tileh;
-	// additional bytes to reach the correct line of the tile
-	uint32_t y_add = (yy * props->tilew * props->bits_per_pixel) >> 3;
+	job->needs = INT32_MAX;
+	for (int layer = 0; layer < 2; layer++) {
+		int16_t *writer = layer_line_writer[layer];
+
+		for (int x = span->layer_clear_from[layer]; x < SCREEN_WIDTH; x++) {
+			writer[x] = index;
+		}
+		if (span->cached) {
+			continue;
+		}
+		if (job->layer_line_enable[layer] && span->layer_begin != span->layer_end) {
+			for (int x = span->layer_begin; x < span->layer_end; x++) {
+				writer[x] = index;
+			}
+		} else if (span->composes) {
+			// the columns no line of the batch has written are the same
+			// for all bands
+			for (int x = span->layer_begin; x < span->layer_end; x++) {
+				if (writer[x] >= 0) {
+					job->needs = MIN(job->needs, writer[x]);
+				}
+			}
+		}
+	}
+}
 
-	// Render tile line.
-	for (int x = 0; x < SCREEN_WIDTH; x++) {
-		int xx = x % props->tilew;
+static uint32_t
+count_changed_pages()
+{
+	uint32_t count = 0;
+	for (int page = 0; page < 0x200; page++) {
+		count += render_resync || video_ram_page_versions[page] != sent_page_versions[page];
+	}
+	return count;
+}
 
-		// extract all information from the map
-		uint8_t palette_offset = reg_layer[layer][4] & 0xf;
+// Before a line is looked up in the line cache, which is only up to date
+// for the lines that are not in the batch. A line is only drawn again in
+// the same batch right after itself, which progressive NTSC does, and
+// then it isn't looked up. Returns whether it can be.
+static bool
+prepare_queue(uint16_t y)
+{
+	bool repeated = render_batch_of_line[y] == render_batch;
+	const bool follows = render_jobs_count && render_jobs[render_jobs_count - 1].span.y == y;
+	if ((repeated && !follows) ||
+		render_jobs_count == RENDER_BATCH_LINES ||
+		render_journal_count + count_changed_pages() > RENDER_JOURNAL_PAGES) {
+		render_thread_sync();
+		repeated = false;
+	}
+	render_batch_of_line[y] = render_batch;
+	return !repeated;
+}
 
-		// additional bytes to reach the correct column of the tile
-		uint16_t x_add = (xx * props->bits_per_pixel) >> 3;
-		uint32_t tile_offset = y_add + x_add;
-		uint8_t s = video_space_read(props->tile_base + tile_offset);
+static void
+queue_line(const struct line_span *span)
+{
+	const uint32_t changed_pages = count_changed_pages();
 
-		// convert tile byte to indexed color
-		uint8_t col_index = (s >> (props->first_color_pos - ((xx & props->color_fields_max) << props->color_depth))) & props->color_mask;
+	struct render_job *job = &render_jobs[render_jobs_count];
+	job->span = *span;
+	memcpy(job->reg_composer, reg_composer, sizeof(job->reg_composer));
+	memcpy(job->reg_layer, reg_layer, sizeof(job->reg_layer));
+	memcpy(job->layer_properties, prev_layer_properties, sizeof(job->layer_properties));
+	memcpy(job->layer_line_enable, layer_line_enable, sizeof(job->layer_line_enable));
+	memcpy(job->sprite_line_col, sprite_line_col, sizeof(job->sprite_line_col));
+	memcpy(job->sprite_line_z, sprite_line_z, sizeof(job->sprite_line_z));
+	memcpy(job->line_pages, line_pages, sizeof(job->line_pages));
 
-		// Apply Palette Offset
-		if (col_index > 0 && col_index < 16) {
-			col_index += palette_offset << 4;
-			if (props->text_mode_256c) {
-				col_index |= 0x80;
-			}
+	job->has_layer_lines = render_resync;
+	if (job->has_layer_lines) {
+		memcpy(render_layer_line, layer_line, sizeof(render_layer_line));
+		memcpy(render_col_line, col_line, sizeof(render_col_line));
+	}
+
+	job->journal_begin = render_journal_count;
+	for (int page = 0; changed_pages && page < 0x200; page++) {
+		if (render_resync || video_ram_page_versions[page] != sent_page_versions[page]) {
+			struct journal_page *entry = &render_journal[render_journal_count++];
+			entry->page = page;
+			entry->version = video_ram_page_versions[page];
+			memcpy(entry->data, &video_ram[page << 8], 256);
+			sent_page_versions[page] = video_ram_page_versions[page];
 		}
-		layer_line[layer][x] = col_index;
 	}
+	job->journal_end = render_journal_count;
+	render_resync = false;
+
+	if (render_thread_count > 1) {
+		track_layer_lines(job, render_jobs_count);
+	}
+
+	if (render_thread_count > 1) {
+		// the bands are only drawn at the end of the batch
+		render_jobs_count++;
+		return;
+	}
+	pthread_mutex_lock(&render_mutex);
+	render_jobs_count++;
+	pthread_cond_signal(&render_queued);
+	pthread_mutex_unlock(&render_mutex);
 }
 
-static uint8_t calculate_line_col_index(uint8_t spr_zindex, uint8_t spr_col_index, uint8_t l1_col_index, uint8_t l2_col_index)
+// on a render thread, into its own copy of the VERA state
+static void
+apply_journal(const struct render_job *job)
 {
-	uint8_t col_index = 0;
-	switch (spr_zindex) {
-		case 3:
-			col_index = spr_col_index ? spr_col_index : (l2_col_index ? l2_col_index : l1_col_index);
-			break;
-		case 2:
-			col_index = l2_col_index ? l2_col_index : (spr_col_index ? spr_col_index : l1_col_index);
-			break;
-		case 1:
-			col_index = l2_col_index ? l2_col_index : (l1_col_index ? l1_col_index : spr_col_index);
+	for (uint32_t i = job->journal_begin; i < job->journal_end; i++) {
+		const struct journal_page *entry = &render_journal[i];
+		memcpy(&video_ram[entry->page << 8], entry->data, 256);
+		video_ram_page_versions[entry->page] = entry->version;
+	}
+}
+
+static void
+apply_render_job(const struct render_job *job)
+{
+	memcpy(reg_composer, job->reg_composer, sizeof(job->reg_composer));
+	memcpy(reg_layer, job->reg_layer, sizeof(job->reg_layer));
+	memcpy(prev_layer_properties, job->layer_properties, sizeof(job->layer_properties));
+	memcpy(layer_line_enable, job->layer_line_enable, sizeof(job->layer_line_enable));
+	memcpy(sprite_line_col, job->sprite_line_col, sizeof(job->sprite_line_col));
+	memcpy(sprite_line_z, job->sprite_line_z, sizeof(job->sprite_line_z));
+	memcpy(line_pages, job->line_pages, sizeof(job->line_pages));
+}
+
+// the single render thread
+static void *
+render_thread_main(void *arg)
+{
+	struct render_worker *worker = arg;
+	video_ram = worker->video_ram;
+	tile_row_cache = worker->tile_row_cache;
+	memset(tile_row_cache, 0xff, TILE_ROW_CACHE_SIZE * sizeof(*tile_row_cache));
+
+	pthread_mutex_lock(&render_mutex);
+	for (;;) {
+		while (render_jobs_done == render_jobs_count && !render_thread_quit && !render_fetch) {
+			pthread_cond_wait(&render_queued, &render_mutex);
+		}
+		if (render_jobs_done == render_jobs_count && render_fetch) {
+			memcpy(render_layer_line, layer_line, sizeof(render_layer_line));
+			memcpy(render_col_line, col_line, sizeof(render_col_line));
+			render_fetch = false;
+			pthread_cond_broadcast(&render_done);
+			continue;
+		}
+		if (render_jobs_done == render_jobs_count) {
 			break;
-		case 0:
-			col_index = l2_col_index ? l2_col_index : l1_col_index;
+		}
+		const struct render_job *job = &render_jobs[render_jobs_done];
+		pthread_mutex_unlock(&render_mutex);
+
+		apply_journal(job);
+		apply_render_job(job);
+		if (job->has_layer_lines) {
+			memcpy(layer_line, render_layer_line, sizeof(render_layer_line));
+			memcpy(col_line, render_col_line, sizeof(render_col_line));
+		}
+		const bool drew = draw_line(&job->span);
+
+		pthread_mutex_lock(&render_mutex);
+		if (drew) {
+			add_changed_rows(&framebuffer_changed, job->span.y, job->span.y + 1);
+		}
+		render_jobs_done++;
+		pthread_cond_broadcast(&render_done);
+	}
+	pthread_mutex_unlock(&render_mutex);
+	return NULL;
+}
+
+static void
+draw_band(struct render_worker *worker)
+{
+	worker->drew = (struct row_range){ SCREEN_HEIGHT, 0 };
+	for (uint32_t i = 0; i < render_jobs_count; i++) {
+		const struct render_job *job = &render_jobs[i];
+
+		apply_journal(job);
+		if (i < worker->band_begin || i >= worker->band_end) {
+			continue;
+		}
+		if (i == worker->band_begin) {
+			memcpy(layer_line, render_layer_line, sizeof(render_layer_line));
+			memcpy(col_line, render_col_line, sizeof(render_col_line));
+		}
+		apply_render_job(job);
+		if (draw_line(&job->span)) {
+			add_changed_rows(&worker->drew, job->span.y, job->span.y + 1);
+		}
+		if (i == worker->band_end - 1) {
+			memcpy(worker->layer_line, layer_line, sizeof(layer_line));
+			memcpy(worker->col_line, col_line, sizeof(col_line));
+		}
+	}
+}
+
+// a thread of a band rendering pool
+static void *
+render_band_main(void *arg)
+{
+	struct render_worker *worker = arg;
+	uint32_t generation = 0;
+	video_ram = worker->video_ram;
+	tile_row_cache = worker->tile_row_cache;
+	memset(tile_row_cache, 0xff, TILE_ROW_CACHE_SIZE * sizeof(*tile_row_cache));
+
+	pthread_mutex_lock(&render_mutex);
+	for (;;) {
+		while (render_generation == generation && !render_thread_quit) {
+			pthread_cond_wait(&render_queued, &render_mutex);
+		}
+		if (render_thread_quit) {
 			break;
+		}
+		generation = render_generation;
+		pthread_mutex_unlock(&render_mutex);
+
+		draw_band(worker);
+
+		pthread_mutex_lock(&render_mutex);
+		render_bands_done++;
+		pthread_cond_broadcast(&render_done);
 	}
-	return col_index;
+	pthread_mutex_unlock(&render_mutex);
+	return NULL;
 }
 
 static void
-render_line(uint16_t y, float scan_pos_x)
+draw_bands()
+{
+	static bool can_start[RENDER_BATCH_LINES];
+	const uint32_t count = render_jobs_count;
+
+	// Every band starts with the layer lines and col_line of the start of
+	// the batch, so a band can start at a line if no line from there on
+	// reads a layer line column that an earlier one has written. With the
+	// video output off, a line shows the col_line of the line before.
+	int32_t needs = INT32_MAX;
+	for (int32_t i = count - 1; i >= 0; i--) {
+		const struct render_job *job = &render_jobs[i];
+		needs = MIN(needs, job->needs);
+		can_start[i] = i == 0 || (job->span.x_begin == 0 && job->span.y != render_jobs[i - 1].span.y && (job->reg_composer[0] & 3) && needs >= i);
+	}
+
+	uint32_t starts[RENDER_MAX_THREADS];
+	int bands = 0;
+	for (int k = 0; k < render_thread_count; k++) {
+		uint32_t start = (uint64_t)count * k / render_thread_count;
+		while (start < count && !can_start[start]) {
+			start++;
+		}
+		if (start < count && (bands == 0 || start > starts[bands - 1])) {
+			starts[bands++] = start;
+		}
+	}
+	for (int k = 0; k < render_thread_count; k++) {
+		render_workers[k].band_begin = k < bands ? starts[k] : count;
+		render_workers[k].band_end = k + 1 < bands ? starts[k + 1] : count;
+	}
+
+	render_stat_batches++;
+	render_stat_bands += bands;
+
+	pthread_mutex_lock(&render_mutex);
+	render_bands_done = 0;
+	render_generation++;
+	pthread_cond_broadcast(&render_queued);
+	while (render_bands_done < render_thread_count) {
+		pthread_cond_wait(&render_done, &render_mutex);
+	}
+	pthread_mutex_unlock(&render_mutex);
+
+	// the layer lines as the batch has left them
+	for (int layer = 0; layer < 2; layer++) {
+		for (int x = 0; x < SCREEN_WIDTH; x++) {
+			const int16_t writer = layer_line_writer[layer][x];
+			int k = bands - 1;
+			while (k > 0 && starts[k] > writer) {
+				k--;
+			}
+			if (writer >= 0) {
+				render_layer_line[layer][x] = render_workers[k].layer_line[layer][x];
+			}
+		}
+	}
+	memset(layer_line_writer, 0xff, sizeof(layer_line_writer));
+	if (bands) {
+		memcpy(render_col_line, render_workers[bands - 1].col_line, sizeof(render_col_line));
+	}
+
+	for (int k = 0; k < bands; k++) {
+		add_changed_rows(&framebuffer_changed, render_workers[k].drew.begin, render_workers[k].drew.end);
+	}
+}
+#endif
+
+static void
+render_thread_start(int threads)
+{
+#ifdef MACHINE_LOCAL_PER_THREAD
+	render_jobs = malloc(RENDER_BATCH_LINES * sizeof(struct render_job));
+	render_journal = malloc(RENDER_JOURNAL_PAGES * sizeof(struct journal_page));
+	render_jobs_count = 0;
+	render_journal_count = 0;
+	render_jobs_done = 0;
+	render_thread_quit = false;
+	render_resync = true;
+	render_stat_batches = 0;
+	render_stat_bands = 0;
+	memset(layer_line_writer, 0xff, sizeof(layer_line_writer));
+
+	render_thread_count = 0;
+	bool allocated = render_jobs && render_journal;
+	for (int k = 0; k < threads; k++) {
+		render_workers[k].video_ram = malloc(VIDEO_RAM_SIZE);
+		render_workers[k].tile_row_cache = malloc(TILE_ROW_CACHE_SIZE * sizeof(struct tile_row_cache_entry));
+		allocated &= render_workers[k].video_ram && render_workers[k].tile_row_cache;
+	}
+	if (allocated) {
+		for (int k = 0; k < threads; k++) {
+			if (threads == 1 ?
+				pthread_create(&render_workers[k].thread, NULL, render_thread_main, &render_workers[k]) :
+				pthread_create(&render_workers[k].thread, NULL, render_band_main, &render_workers[k])) {
+				break;
+			}
+			render_thread_count++;
+		}
+	}
+	render_thread_active = true;
+	if (render_thread_count < threads) {
+		printf("Cannot start the render threads, rendering on the CPU thread.\n");
+		render_thread_stop();
+	}
+#else
+	(void)threads;
+	printf("Render threads are not supported on this platform.\n");
+#endif
+}
+
+static void
+render_thread_stop()
+{
+#ifdef MACHINE_LOCAL_PER_THREAD
+	if (!render_thread_active) {
+		return;
+	}
+	pthread_mutex_lock(&render_mutex);
+	render_thread_quit = true;
+	pthread_cond_broadcast(&render_queued);
+	pthread_mutex_unlock(&render_mutex);
+	for (int k = 0; k < render_thread_count; k++) {
+		pthread_join(render_workers[k].thread, NULL);
+	}
+	if (render_thread_count > 1 && render_stat_batches) {
+		printf("Render threads: %u batches, %.1f bands per batch.\n",
+			render_stat_batches, (double)render_stat_bands / render_stat_batches);
+	}
+	for (int k = 0; k < RENDER_MAX_THREADS; k++) {
+		free(render_workers[k].video_ram);
+		free(render_workers[k].tile_row_cache);
+		render_workers[k].video_ram = NULL;
+		render_workers[k].tile_row_cache = NULL;
+	}
+	free(render_jobs);
+	free(render_journal);
+	render_jobs = NULL;
+	render_journal = NULL;
+	render_thread_active = false;
+#endif
+}
+
+// Wait for the queued lines to be drawn.
+static void
+render_thread_sync()
+{
+#ifdef MACHINE_LOCAL_PER_THREAD
+	if (!render_thread_active || !render_jobs_count) {
+		return;
+	}
+	if (render_thread_count > 1) {
+		draw_bands();
+	}
+	pthread_mutex_lock(&render_mutex);
+	while (render_thread_count == 1 && render_jobs_done != render_jobs_count) {
+		pthread_cond_wait(&render_done, &render_mutex);
+	}
+	render_jobs_count = 0;
+	render_journal_count = 0;
+	render_jobs_done = 0;
+	pthread_mutex_unlock(&render_mutex);
+	render_batch++;
+#endif
+}
+
+// Take back the layer lines and col_line as the render threads have left
+// them, for a save state.
+static void
+render_thread_fetch_lines()
+{
+#ifdef MACHINE_LOCAL_PER_THREAD
+	// not after a state load before the lines have been sent
+	if (!render_thread_active || render_resync) {
+		return;
+	}
+	render_thread_sync();
+	if (render_thread_count == 1) {
+		pthread_mutex_lock(&render_mutex);
+		render_fetch = true;
+		pthread_cond_signal(&render_queued);
+		while (render_fetch) {
+			pthread_cond_wait(&render_done, &render_mutex);
+		}
+		pthread_mutex_unlock(&render_mutex);
+	}
+	memcpy(layer_line, render_layer_line, sizeof(layer_line));
+	memcpy(col_line, render_col_line, sizeof(col_line));
+#endif
+}
+
+// Leaves the VRAM pages the sprite line has read in line_pages.
+static void
+update_sprite_line(uint16_t eff_y)
 {
-	static uint16_t y_prev;
-	static uint16_t s_pos_x_p;
-	static uint32_t eff_y_fp; // 16.16 fixed point
-	static uint32_t eff_x_fp; // 16.16 fixed point
+	struct sprite_line_key *key = &sprite_line_key;
 
-	static uint8_t col_line[SCREEN_WIDTH];
+	if (key->valid && key->eff_y == eff_y && key->sprite_version == sprite_version && sum_page_versions(key->pages) == key->page_versions) {
+		memcpy(line_pages, key->pages, sizeof(line_pages));
+		return;
+	}
 
+	memset(line_pages, 0, sizeof(line_pages));
+	render_sprite_line(eff_y);
+
+	key->valid          = true;
+	key->eff_y          = eff_y;
+	key->sprite_version = sprite_version;
+	memcpy(key->pages, line_pages, sizeof(key->pages));
+	key->page_versions  = sum_page_versions(key->pages);
+}
+
+static void
+render_line(uint16_t y, float scan_pos_x)
+{
 	uint8_t dc_video = reg_composer[0];
 	uint16_t vstart = reg_composer[6] << 1;
 	uint16_t vstop = reg_composer[7] << 1;
@@ -1088,9 +2142,8 @@ render_line(uint16_t y, float scan_pos_x)
 
 	uint8_t out_mode = reg_composer[0] & 3;
 
-	uint8_t border_color = reg_composer[3];
-	uint16_t hstart = reg_composer[4] << 2;
-	uint16_t hstop = reg_composer[5] << 2;
+	uint16_t hstart = MIN(reg_composer[4] << 2, SCREEN_WIDTH);
+	uint16_t hstop = MIN(reg_composer[5] << 2, SCREEN_WIDTH);
 
 	uint16_t eff_y = (eff_y_fp >> 16);
 	if (eff_y >= 480) eff_y = 480 - (y & 1);
@@ -1102,9 +2155,7 @@ render_line(uint16_t y, float scan_pos_x)
 	// clear layer_line if layer gets disabled
 	for (uint8_t layer = 0; layer < 2; layer++) {
 		if (!layer_line_enable[layer] && old_layer_line_enable[layer]) {
-			for (uint16_t i = s_pos_x_p; i < SCREEN_WIDTH; i++) {
-				layer_line[layer][i] = 0;
-			}
+			layer_clear_from[layer] = MIN(layer_clear_from[layer], s_pos_x_p);
 		}
 		if (s_pos_x_p == 0)
 			old_layer_line_enable[layer] = layer_line_enable[layer];
@@ -1117,6 +2168,8 @@ render_line(uint16_t y, float scan_pos_x)
 			sprite_line_z[i] = 0;
 			sprite_line_mask[i] = 0;
 		}
+		sprite_line_cleared = true;
+		sprite_line_key.valid = false;
 	}
 
 	if (s_pos_x_p == 0)
@@ -1125,90 +2178,88 @@ render_line(uint16_t y, float scan_pos_x)
 
 
 	if (sprite_line_enable) {
-		render_sprite_line(eff_y);
+		update_sprite_line(eff_y);
+	} else {
+		memset(line_pages, 0, sizeof(line_pages));
 	}
 
-	if (warp_mode && (frame_count & 63)) {
+	if (headless || (warp_mode && (frame_count & 63))) {
 		// sprites were needed for the collision IRQ, but we can skip
-		// everything else if we're in warp mode, most of the time
+		// everything else if we're in warp mode, most of the time,
+		// and always if nothing is ever displayed
 		return;
 	}
 
-	if (layer_line_enable[0]) {
-		if (prev_layer_properties[1][0].text_mode) {
-			render_layer_line_text(0, eff_y);
-		} else if (prev_layer_properties[1][0].bitmap_mode) {
-			render_layer_line_bitmap(0, eff_y);
-		} else {
-			render_layer_line_tile(0, eff_y);
+	struct line_span span = {
+		.y                = y,
+		.x_begin          = s_pos_x_p,
+		.x_end            = s_pos_x,
+		.eff_y            = eff_y,
+		.eff_x_fp         = eff_x_fp,
+		.layer_clear_from = { layer_clear_from[0], layer_clear_from[1] },
+	};
+	for (uint8_t layer = 0; layer < 2; layer++) {
+		if (layer_clear_from[layer] < SCREEN_WIDTH) {
+			line_cache_epoch++;
 		}
+		layer_clear_from[layer] = SCREEN_WIDTH;
 	}
-	if (layer_line_enable[1]) {
-		if (prev_layer_properties[1][1].text_mode) {
-			render_layer_line_text(1, eff_y);
-		} else if (prev_layer_properties[1][1].bitmap_mode) {
-			render_layer_line_bitmap(1, eff_y);
-		} else {
-			render_layer_line_tile(1, eff_y);
-		}
+	if (sprite_line_cleared) {
+		line_cache_epoch++;
+		sprite_line_cleared = false;
 	}
 
-	// If video output is enabled, calculate color indices for line.
-	if (out_mode != 0) {
-		// Add border after if required.
-		if (y < vstart || y >= vstop) {
-			uint32_t border_fill = border_color;
-			border_fill = border_fill | (border_fill << 8);
-			border_fill = border_fill | (border_fill << 16);
-			memset(col_line, border_fill, SCREEN_WIDTH);
-		} else {
-			hstart = hstart < 640 ? hstart : 640;
-			hstop = hstop < 640 ? hstop : 640;
+	// Only the columns of the layers that this part of the line shows get
+	// rendered, so the parts of a line split by midline writes add up to a
+	// single line's worth of work.
+	const uint32_t scale   = reg_composer[1];
+	const uint16_t begin   = MAX(hstart, s_pos_x_p);
+	const uint16_t end     = MIN(hstop, s_pos_x);
+	span.layer_begin = MIN(eff_x_fp >> 16, SCREEN_WIDTH);
+	span.layer_end   = span.layer_begin;
+	span.composes    = out_mode != 0 && y >= vstart && y < vstop && begin < end;
+	if (span.composes) {
+		span.layer_end = MIN(((eff_x_fp + (end - begin - 1) * (scale << 9)) >> 16) + 1, SCREEN_WIDTH);
+		eff_x_fp += (end - begin) * (scale << 9);
+	}
 
-			for (uint16_t x = s_pos_x_p; x < hstart && x < s_pos_x; ++x) {
-				col_line[x] = border_color;
-			}
+	span.palette = current_frame_palette();
 
-			const uint32_t scale = reg_composer[1];
-			for (uint16_t x = MAX(hstart, s_pos_x_p); x < hstop && x < s_pos_x; ++x) {
-				uint16_t eff_x = eff_x_fp >> 16;
-				col_line[x] = (eff_x < SCREEN_WIDTH) ? calculate_line_col_index(sprite_line_z[eff_x], sprite_line_col[eff_x], layer_line[0][eff_x], layer_line[1][eff_x]) : 0;
-				eff_x_fp += (scale << 9);
-			}
-			for (uint16_t x = hstop; x < s_pos_x; ++x) {
-				col_line[x] = border_color;
-			}
-		}
+	bool lookup = true;
+#ifdef MACHINE_LOCAL_PER_THREAD
+	if (render_thread_active) {
+		lookup = prepare_queue(y);
 	}
-
-	// Look up all color indices.
-	uint32_t* framebuffer4_begin = ((uint32_t*)framebuffer) + (y * SCREEN_WIDTH) + s_pos_x_p;
-	{
-		uint32_t* framebuffer4 = framebuffer4_begin;
-		for (uint16_t x = s_pos_x_p; x < s_pos_x; x++) {
-			*framebuffer4++ = video_palette.entries[col_line[x]];
-		}
+#endif
+	if (s_pos_x_p == 0 && s_pos_x == SCREEN_WIDTH) {
+		const struct line_cache_entry *cached_line = &line_cache[y];
+		struct line_cache_key *key = &span.key;
+		memset(key, 0, sizeof(*key));
+		memcpy(key->layer_properties, prev_layer_properties, sizeof(key->layer_properties));
+		memcpy(key->reg_composer, reg_composer, sizeof(key->reg_composer));
+		key->reg_composer[0] &= 0x7f; // without the interlace field
+		memcpy(key->reg_layer, reg_layer, sizeof(key->reg_layer));
+		key->eff_y           = eff_y;
+		key->palette_version = palette_version;
+		key->sprite_version  = sprite_version;
+		key->epoch           = line_cache_epoch;
+
+		span.cached = lookup && cached_line->valid && !memcmp(&cached_line->key, key, sizeof(*key)) && sum_page_versions(cached_line->pages) == cached_line->page_versions;
+	} else {
+		// the layer lines will be left half-way between two lines
+		line_cache_epoch++;
 	}
+	s_pos_x_p = s_pos_x;
 
-	// NTSC overscan
-	if (out_mode == 2) {
-		uint32_t* framebuffer4 = framebuffer4_begin;
-		for (uint16_t x = s_pos_x_p; x < s_pos_x; x++)
-		{
-			if (x < SCREEN_WIDTH * TITLE_SAFE_X ||
-				x > SCREEN_WIDTH * (1 - TITLE_SAFE_X) ||
-				y < SCREEN_HEIGHT * TITLE_SAFE_Y ||
-				y > SCREEN_HEIGHT * (1 - TITLE_SAFE_Y)) {
-
-				// Divide RGB elements by 4.
-				*framebuffer4 &= 0x00fcfcfc;
-				*framebuffer4 >>= 2;
-			}
-			framebuffer4++;
-		}
+#ifdef MACHINE_LOCAL_PER_THREAD
+	if (render_thread_active) {
+		queue_line(&span);
+		return;
+	}
+#endif
+	if (draw_line(&span)) {
+		add_changed_rows(&framebuffer_changed, y, y + 1);
 	}
-
-	s_pos_x_p = s_pos_x;
 }
 
 static void
@@ -1220,6 +2271,7 @@ update_isr_and_coll(uint16_t y, uint16_t compare)
 		}
 		isr = (isr & 0xf) | sprite_line_collisions;
 		sprite_line_collisions = 0;
+		sprite_line_key.valid = false;
 		isr |= 1; // VSYNC IRQ
 	}
 	if (y == compare) { // LINE IRQ
@@ -1314,6 +2366,17 @@ video_step(float mhz, float steps, bool midline)
 	return new_frame;
 }
 
+// clocks until the end of the current VGA line or NTSC half line,
+// video_step() advances by at most one of each per call
+uint32_t
+video_next_event(float mhz)
+{
+	float vga = (VGA_SCAN_WIDTH - vga_scan_pos_x) * mhz / PIXEL_FREQ;
+	float ntsc = (NTSC_HALF_SCAN_WIDTH - ntsc_half_cnt) * mhz / PIXEL_FREQ;
+	float next = vga < ntsc ? vga : ntsc;
+	return next > 0 ? (uint32_t)next + 1 : 1;
+}
+
 bool
 video_get_irq_out()
 {
@@ -1335,36 +2398,129 @@ video_save(SDL_RWops *f)
 	SDL_RWwrite(f, &sprite_data[0], sizeof(uint8_t), sizeof(sprite_data));
 }
 
+// The activity LED is a red 8x4 square in the top right corner, blended
+// over the screen by its brightness; for progressive modes, only on the
+// even scanlines.
+static void
+render_activity_led()
+{
+	static int led_rows = 0;
+	const int rows = (reg_composer[0] & 0x0b) > 0x09 ? 0x5 : 0xf;
+
+	if (rows != led_rows) {
+		uint32_t pixels[4 * 8];
+		for (int i = 0; i < 4 * 8; i++) {
+			pixels[i] = (rows >> (i / 8)) & 1 ? 0xffff0000 : 0x00000000;
+		}
+		SDL_UpdateTexture(led_texture, NULL, pixels, 8 * 4);
+		led_rows = rows;
+	}
+
+	int width, height;
+	SDL_RenderGetLogicalSize(renderer, &width, &height);
+	const SDL_Rect rect = {
+		width - 8 * width / SCREEN_WIDTH, 0,
+		8 * width / SCREEN_WIDTH, 4
+	};
+	SDL_SetTextureAlphaMod(led_texture, activity_led);
+	SDL_RenderCopy(renderer, led_texture, NULL, &rect);
+}
+
+struct gif_frame {
+	uint32_t palette[256];
+	bool indexed;
+	// the color indices or the colors follow
+};
+
+// set on the recorder thread if the GIF couldn't be written
+static SDL_atomic_t gif_failed;
+
+static void
+write_gif_frame_job(void *data, uint32_t size)
+{
+	(void)size;
+	const struct gif_frame *frame = data;
+	if (SDL_AtomicGet(&gif_failed)) {
+		return;
+	}
+	const bool ok = frame->indexed ?
+		gif_recorder_add_indexed((const uint8_t *)(frame + 1), frame->palette, 2) :
+		gif_recorder_add_rgb((const uint32_t *)(frame + 1), frame->palette, 2);
+	if (!ok) {
+		gif_recorder_end();
+		SDL_AtomicSet(&gif_failed, 1);
+	}
+}
+
+static void
+end_gif_job(void *data, uint32_t size)
+{
+	(void)data;
+	(void)size;
+	gif_recorder_end();
+}
+
+// The color indices are only good for a GIF if all rows show the current
+// palette, which they usually do. The frame is copied for the recorder
+// thread to encode.
+static bool
+write_gif_frame()
+{
+	if (SDL_AtomicGet(&gif_failed)) {
+		return false;
+	}
+
+	bool indexed = true;
+	for (uint16_t y = 0; y < SCREEN_HEIGHT; y++) {
+		if (row_palette_versions[y] != palette_version + 1) {
+			indexed = false;
+			break;
+		}
+	}
+	const uint32_t pixels_size = indexed ? sizeof(framebuffer_indices) : sizeof(framebuffer);
+	struct gif_frame *frame = recorder_queue(write_gif_frame_job, sizeof(struct gif_frame) + pixels_size);
+	if (!frame) {
+		return false;
+	}
+	memcpy(frame->palette, video_palette.entries, sizeof(frame->palette));
+	frame->indexed = indexed;
+	memcpy(frame + 1, indexed ? (const void *)framebuffer_indices : (const void *)framebuffer, pixels_size);
+	recorder_submit();
+	return true;
+}
+
 bool
 video_update()
 {
 	static bool cmd_down = false;
 	static bool alt_down = false;
+	static bool window_changed = false;
+	static uint8_t presented_led = 0;
 	bool mouse_changed = false;
 
-	// for activity LED, overlay red 8x4 square into top right of framebuffer
-	// for progressive modes, draw LED only on even scanlines
-	for (int y = 0; y < 4; y+=1+!!((reg_composer[0] & 0x0b) > 0x09)) {
-		for (int x = SCREEN_WIDTH - 8; x < SCREEN_WIDTH; x++) {
-			uint8_t b = framebuffer[(y * SCREEN_WIDTH + x) * 4 + 0];
-			uint8_t g = framebuffer[(y * SCREEN_WIDTH + x) * 4 + 1];
-			uint8_t r = framebuffer[(y * SCREEN_WIDTH + x) * 4 + 2];
-			r = (uint32_t)r * (255 - activity_led) / 255 + activity_led;
-			g = (uint32_t)g * (255 - activity_led) / 255;
-			b = (uint32_t)b * (255 - activity_led) / 255;
-			framebuffer[(y * SCREEN_WIDTH + x) * 4 + 0] = b;
-			framebuffer[(y * SCREEN_WIDTH + x) * 4 + 1] = g;
-			framebuffer[(y * SCREEN_WIDTH + x) * 4 + 2] = r;
-			framebuffer[(y * SCREEN_WIDTH + x) * 4 + 3] = 0x00;
-		}
-	}
+	render_thread_sync();
+
+	look_up_rows();
 
-	SDL_UpdateTexture(sdlTexture, NULL, framebuffer, SCREEN_WIDTH * 4);
+	// nothing new to show if no line has been drawn since the last frame
+	const struct row_range changed = framebuffer_changed;
+	const bool present = changed.begin < changed.end || window_changed || activity_led != presented_led || (debugger_enabled && showDebugOnRender != 0);
+	framebuffer_changed = (struct row_range){ SCREEN_HEIGHT, 0 };
+	window_changed = false;
+	presented_led = activity_led;
+
+	// the texture keeps the rows that haven't been drawn again
+	if (changed.begin < changed.end) {
+		const SDL_Rect rect = { 0, changed.begin, SCREEN_WIDTH, changed.end - changed.begin };
+		SDL_UpdateTexture(sdlTexture, &rect, &framebuffer[changed.begin * SCREEN_WIDTH * 4], SCREEN_WIDTH * 4);
+	}
 
 	if (record_gif > RECORD_GIF_PAUSED) {
-		if(!GifWriteFrame(&gif_writer, framebuffer, SCREEN_WIDTH, SCREEN_HEIGHT, 2, 8, false)) {
+		if (!write_gif_frame()) {
 			// if that failed, stop recording
-			GifEnd(&gif_writer);
+			if (recorder_queue(end_gif_job, 0)) {
+				recorder_submit();
+			}
 			record_gif = RECORD_GIF_DISABLED;
 			printf("Unexpected end of recording.\n");
 		}
@@ -1373,22 +2529,35 @@ video_update()
 		}
 	}
 
-	SDL_RenderClear(renderer);
-	SDL_RenderCopy(renderer, sdlTexture, NULL, NULL);
+	if (present) {
+		SDL_RenderClear(renderer);
+		SDL_RenderCopy(renderer, sdlTexture, NULL, NULL);
+		if (activity_led) {
+			render_activity_led();
+		}
+
+		if (debugger_enabled && showDebugOnRender != 0) {
+			DEBUGRenderDisplay(SCREEN_WIDTH, SCREEN_HEIGHT);
+			SDL_RenderPresent(renderer);
+			return true;
+		}
 
-	if (debugger_enabled && showDebugOnRender != 0) {
-		DEBUGRenderDisplay(SCREEN_WIDTH, SCREEN_HEIGHT);
 		SDL_RenderPresent(renderer);
-		return true;
 	}
 
-	SDL_RenderPresent(renderer);
-
 	SDL_Event event;
 	while (SDL_PollEvent(&event)) {
 		if (event.type == SDL_QUIT) {
 			return false;
 		}
+		if (event.type == SDL_WINDOWEVENT) {
+			// the window may have to be redrawn
+			window_changed = true;
+		}
+		if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET) {
+			// the texture may have lost its contents
+			add_changed_rows(&framebuffer_changed, 0, SCREEN_HEIGHT);
+		}
 		if (event.type == SDL_KEYDOWN) {
 			bool consumed = false;
 			if (cmd_down && !(disable_emu_cmd_keys || mouse_grabbed)) {
@@ -1398,6 +2567,15 @@ video_update()
 				} else if (event.key.keysym.sym == SDLK_r) {
 					machine_reset();
 					consumed = true;
+				} else if (event.key.keysym.sym == SDLK_F5) {
+					machine_save_state();
+					consumed = true;
+				} else if (event.key.keysym.sym == SDLK_F9) {
+					machine_load_state();
+					consumed = true;
+				} else if (event.key.keysym.sym == SDLK_z && rewind_enabled()) {
+					rewinding = true;
+					consumed = true;
 				} else if (event.key.keysym.sym == SDLK_BACKSPACE) {
 					machine_nmi();
 					consumed = true;
@@ -1453,6 +2631,10 @@ video_update()
 			continue;
 		}
 		if (event.type == SDL_KEYUP) {
+			if (rewinding && event.key.keysym.sym == SDLK_z) {
+				rewinding = false;
+				continue;
+			}
 			if (event.key.keysym.scancode == LSHORTCUT_KEY || event.key.keysym.scancode == RSHORTCUT_KEY) {
 				cmd_down = false;
 			}
@@ -1534,12 +2716,16 @@ video_update()
 void
 video_end()
 {
+	render_thread_stop();
+
 	if (debugger_enabled) {
 		DEBUGFreeUI();
 	}
 
 	if (record_gif != RECORD_GIF_DISABLED) {
-		GifEnd(&gif_writer);
+		if (recorder_queue(end_gif_job, 0)) {
+			recorder_submit();
+		}
 		record_gif = RECORD_GIF_DISABLED;
 	}
 
@@ -1683,6 +2869,12 @@ fx_affine_prefetch(void)
 // Vera: Internal Video Address Space
 //
 
+uint8_t *
+video_ram_page(int page)
+{
+	return &video_ram[page << 8];
+}
+
 uint8_t
 video_space_read(uint32_t address)
 {
@@ -1705,6 +2897,7 @@ void
 video_space_write(uint32_t address, uint8_t value)
 {
 	video_ram[address & 0x1FFFF] = value;
+	video_ram_page_versions[(address & 0x1FFFF) >> 8]++;
 
 	if (address >= ADDR_PSG_START && address < ADDR_PSG_END) {
 		audio_render();
@@ -1735,6 +2928,7 @@ fx_video_space_write(uint32_t address, bool nibble, uint8_t value)
 	} else {
 		if (!fx_trans_writes || value > 0) video_ram[address & 0x1FFFF] = value;
 	}
+	video_ram_page_versions[(address & 0x1FFFF) >> 8]++;
 	if (address >= ADDR_PSG_START && address < ADDR_PSG_END) {
 		audio_render();
 		psg_writereg(address & 0x3f, value);
@@ -1765,6 +2959,7 @@ fx_vram_cache_write(uint32_t address, uint8_t value, uint8_t mask)
 				// Do nothing
 				break;
 		}
+		video_ram_page_versions[(address & 0x1FFFF) >> 8]++;
 	}
 }
 
@@ -2115,6 +3310,7 @@ void video_write(uint8_t reg, uint8_t value) {
 						video_ram[io_addr[1] & 0x1FFFF] = (fx_cache[fx_cache_byte_index] & 0x03) | (io_rddata[1] & 0xfc);
 						break;
 				}
+				video_ram_page_versions[(io_addr[1] & 0x1FFFF) >> 8]++;
 				break; // break out of the enclosing switch statement early, too
 			}
 
@@ -2223,9 +3419,16 @@ void video_write(uint8_t reg, uint8_t value) {
 				// if progressive mode field goes from 0 to 1
 				// or if mode goes from vga to something else with
 				// progressive mode on, clear the framebuffer
-				if (((reg_composer[0] & 0x8) == 0 && (value & 0x8)) ||
-					((reg_composer[0] & 0x3) == 1 && (value & 0x3) > 1 && (value & 0x8))) {
+				// (only x16emu's own machine has a framebuffer)
+				if (!headless &&
+					(((reg_composer[0] & 0x8) == 0 && (value & 0x8)) ||
+					((reg_composer[0] & 0x3) == 1 && (value & 0x3) > 1 && (value & 0x8)))) {
+					render_thread_sync();
 					memset(framebuffer, 0x00, SCREEN_WIDTH * SCREEN_HEIGHT * 4);
+					memset(drawn_rows, 0, sizeof(drawn_rows));
+					memset(row_palette_versions, 0, sizeof(row_palette_versions));
+					line_cache_epoch++;
+					add_changed_rows(&framebuffer_changed, 0, SCREEN_HEIGHT);
 				}
 
 				// interlace field bit is read-only
@@ -2445,3 +3648,107 @@ stop6502(uint16_t address, uint8_t bank) {
 		};
 	}
 }
+
+void
+video_state(state_t *s)
+{
+	if (s->loading) {
+		render_thread_sync();
+	} else {
+		render_thread_fetch_lines();
+	}
+	if (!s->devices_only) {
+		state_data(s, video_ram, VIDEO_RAM_SIZE);
+		if (s->loading) {
+			for (int i = 0; i < 0x200; i++) {
+				video_ram_page_versions[i]++;
+			}
+		}
+	}
+	STATE(s, palette);
+	STATE(s, sprite_data);
+	STATE(s, io_addr);
+	STATE(s, io_rddata);
+	STATE(s, io_inc);
+	STATE(s, io_addrsel);
+	STATE(s, io_dcsel);
+	STATE(s, ien);
+	STATE(s, isr);
+	STATE(s, irq_line);
+	STATE(s, reg_layer);
+	STATE(s, reg_composer);
+	STATE(s, prev_reg_composer);
+	STATE(s, layer_properties);
+	STATE(s, prev_layer_properties);
+	STATE(s, sprite_properties);
+	if (s->loading) {
+		refresh_sprite_line_bits();
+	}
+
+	STATE(s, layer_line);
+	STATE(s, sprite_line_col);
+	STATE(s, sprite_line_z);
+	STATE(s, sprite_line_mask);
+	STATE(s, sprite_line_collisions);
+	if (s->loading) {
+		sprite_line_dirty_begin = 0;
+		sprite_line_dirty_end = SCREEN_WIDTH;
+		sprite_line_key.valid = false;
+	}
+	STATE(s, layer_line_enable);
+	STATE(s, old_layer_line_enable);
+	STATE(s, old_sprite_line_enable);
+	STATE(s, sprite_line_enable);
+	STATE(s, y_prev);
+	STATE(s, s_pos_x_p);
+	STATE(s, eff_y_fp);
+	STATE(s, eff_x_fp);
+	STATE(s, col_line);
+
+	STATE(s, fx_addr1_mode);
+	STATE(s, fx_x_pixel_increment);
+	STATE(s, fx_y_pixel_increment);
+	STATE(s, fx_x_pixel_position);
+	STATE(s, fx_y_pixel_position);
+	STATE(s, fx_poly_fill_length);
+	STATE(s, fx_affine_tile_base);
+	STATE(s, fx_affine_map_base);
+	STATE(s, fx_affine_map_size);
+	STATE(s, fx_4bit_mode);
+	STATE(s, fx_16bit_hop);
+	STATE(s, fx_cache_byte_cycling);
+	STATE(s, fx_cache_fill);
+	STATE(s, fx_cache_write);
+	STATE(s, fx_trans_writes);
+	STATE(s, fx_2bit_poly);
+	STATE(s, fx_2bit_poking);
+	STATE(s, fx_cache_increment_mode);
+	STATE(s, fx_cache_nibble_index);
+	STATE(s, fx_cache_byte_index);
+	STATE(s, fx_multiplier);
+	STATE(s, fx_subtract);
+	STATE(s, fx_affine_clip);
+	STATE(s, fx_16bit_hop_align);
+	STATE(s, fx_nibble_bit);
+	STATE(s, fx_nibble_incr);
+	STATE(s, fx_cache);
+	STATE(s, fx_mult_accumulator);
+
+	STATE(s, vga_scan_pos_x);
+	STATE(s, vga_scan_pos_y);
+	STATE(s, ntsc_half_cnt);
+	STATE(s, ntsc_scan_pos_y);
+	STATE(s, frame_count);
+
+	if (s->loading) {
+		video_palette.dirty = true;
+		if (!headless) {
+			line_cache_epoch++;
+		}
+#ifdef MACHINE_LOCAL_PER_THREAD
+		if (render_thread_active) {
+			render_resync = true;
+		}
+#endif
+	}
+}
@@ -11,9 +11,15 @@
 #include <SDL.h>
 #include "glue.h"
 
+// for -render-threads
+#define RENDER_MAX_THREADS 16
+
 bool video_init(int window_scale, float screen_x_scale, char *quality, bool fullscreen, float opacity);
+bool video_create(void);
+void video_destroy(void);
 void video_reset(void);
 bool video_step(float mhz, float steps, bool midline);
+uint32_t video_next_event(float mhz);
 bool video_update(void);
 void video_end(void);
 bool video_get_irq_out(void);
@@ -25,6 +31,10 @@ void video_update_title(const char* window_title);
 uint8_t via1_read(uint8_t reg, bool debug);
 void via1_write(uint8_t reg, uint8_t value);
 
+// host memory of a 256 byte page of VRAM and its write counters
+uint8_t *video_ram_page(int page);
+extern machine_local uint32_t video_ram_page_versions[0x200];
+
 // For debugging purposes only:
 uint8_t video_space_read(uint32_t address);
 void video_space_write(uint32_t address, uint8_t value);
@@ -7,6 +7,8 @@
 #include "SDL.h"
 #include "audio.h"
 #include "glue.h"
+#include "recorder.h"
+#include <stdbool.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -45,6 +47,13 @@ static SDL_RWops * wav_file = NULL;
 static file_header wav_header;
 static uint32_t    wav_samples_written = 0;
 
+// Samples copied while the audio device is locked, queued by
+// wav_recorder_flush() once it has been unlocked, as that may wait.
+static int16_t *wav_staging = NULL;
+static uint32_t wav_staging_size = 0; // in stereo samples
+static uint32_t wav_staged = 0;
+static bool     wav_begin_pending = false;
+
 static void
 wav_init_file_header(file_header *header)
 {
@@ -82,9 +91,14 @@ wav_update_sizes()
 	wav_header.riff.size = 4 + sizeof(fmt_chunk) + sizeof(data_chunk) + (wav_header.data.size);
 }
 
+// The file is written on the recorder thread.
 static void
-wav_begin(const char *path, int32_t sample_rate)
+wav_begin_job(void *data, uint32_t size)
 {
+	(void)size;
+	const int32_t sample_rate = *(int32_t *)data;
+	const char *path = (char *)data + sizeof(int32_t);
+
 	wav_file = SDL_RWFromFile(path, "wb");
 	if (wav_file) {
 		wav_init_file_header(&wav_header);
@@ -102,8 +116,10 @@ wav_begin(const char *path, int32_t sample_rate)
 }
 
 static void
-wav_end()
+wav_end_job(void *data, uint32_t size)
 {
+	(void)data;
+	(void)size;
 	if (wav_file != NULL) {
 		wav_update_sizes();
 		SDL_RWseek(wav_file, 0, RW_SEEK_SET);
@@ -114,18 +130,56 @@ wav_end()
 }
 
 static void
-wav_add(const int16_t *samples, const int num_samples)
+wav_add_job(void *data, uint32_t size)
 {
 	if (wav_file) {
-		const size_t bytes   = sizeof(int16_t) * 2 * num_samples;
-		const size_t written = SDL_RWwrite(wav_file, samples, bytes, 1);
+		const size_t written = SDL_RWwrite(wav_file, data, size, 1);
 		if (written == 0) {
 			SDL_RWclose(wav_file);
 			wav_file = NULL;
 		} else {
-			wav_samples_written += num_samples;
+			wav_samples_written += size / (sizeof(int16_t) * 2);
+		}
+	}
+}
+
+static void
+wav_begin(const char *path, int32_t sample_rate)
+{
+	const uint32_t size = sizeof(int32_t) + strlen(path) + 1;
+	uint8_t *data = recorder_queue(wav_begin_job, size);
+	if (data) {
+		memcpy(data, &sample_rate, sizeof(int32_t));
+		strcpy((char *)data + sizeof(int32_t), path);
+		recorder_submit();
+	}
+}
+
+static void
+wav_end()
+{
+	if (recorder_queue(wav_end_job, 0)) {
+		recorder_submit();
+	}
+}
+
+// This is called with the audio device locked, so it only copies the
+// samples.
+static void
+wav_add(const int16_t *samples, const int num_samples)
+{
+	if (wav_staged + num_samples > wav_staging_size) {
+		const uint32_t size = (wav_staged + num_samples) * 2;
+		int16_t *staging = realloc(wav_staging, sizeof(int16_t) * 2 * size);
+		if (!staging) {
+			printf("Cannot buffer the samples for WAV recording!\n");
+			return;
 		}
+		wav_staging = staging;
+		wav_staging_size = size;
 	}
+	memcpy(&wav_staging[wav_staged * 2], samples, sizeof(int16_t) * 2 * num_samples);
+	wav_staged += num_samples;
 }
 
 // WAV recorder states
@@ -142,9 +196,13 @@ static char *               Wav_path         = NULL;
 void
 wav_recorder_shutdown()
 {
+	wav_recorder_flush();
 	if (Wav_record_state == RECORD_WAV_RECORDING) {
 		wav_end();
 	}
+	free(wav_staging);
+	wav_staging = NULL;
+	wav_staging_size = 0;
 }
 
 void
@@ -154,8 +212,9 @@ wav_recorder_process(const int16_t *samples, const int num_samples)
 	if (Wav_record_state == RECORD_WAV_AUTOSTARTING) {
 		for (i = 0; i < num_samples; ++i) {
 			if (samples[i] != 0) {
+				// the file is begun by wav_recorder_flush()
+				wav_begin_pending = true;
 				Wav_record_state = RECORD_WAV_RECORDING;
-				wav_begin(Wav_path, host_sample_rate);
 				break;
 			}
 		}
@@ -166,6 +225,28 @@ wav_recorder_process(const int16_t *samples, const int num_samples)
 	}
 }
 
+// Queue the samples wav_recorder_process() has copied. This waits for the
+// recorder thread if its queue is full, so the audio device mustn't be
+// locked.
+void
+wav_recorder_flush()
+{
+	if (wav_begin_pending) {
+		wav_begin(Wav_path, host_sample_rate);
+		wav_begin_pending = false;
+	}
+	if (!wav_staged) {
+		return;
+	}
+	const uint32_t bytes = sizeof(int16_t) * 2 * wav_staged;
+	void *data = recorder_queue(wav_add_job, bytes);
+	if (data) {
+		memcpy(data, wav_staging, bytes);
+		recorder_submit();
+	}
+	wav_staged = 0;
+}
+
 void
 wav_recorder_set(wav_recorder_command_t command)
 {
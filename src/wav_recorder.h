@@ -15,6 +15,7 @@ typedef enum {
 
 void wav_recorder_shutdown();
 void wav_recorder_process(const int16_t *samples, const int num_samples);
+void wav_recorder_flush();
 
 void    wav_recorder_set(wav_recorder_command_t command);
 uint8_t wav_recorder_get_state();
@@ -1,5 +1,8 @@
 #include "ymglue.h"
 #include "ymfm_opm.h"
+#include "machine.h"
+#include "savestate.h"
+#include <vector>
 #include <cstdint>
 
 class ym2151_interface : public ymfm::ymfm_interface {
@@ -83,6 +86,13 @@ class ym2151_interface : public ymfm::ymfm_interface {
 			return m_irq_status;
 		}
 
+		void save_restore(ymfm::ymfm_saved_state &state) {
+			m_chip.save_restore(state);
+			state.save_restore(m_timers);
+			state.save_restore(m_busy_timer);
+			state.save_restore(m_irq_status);
+		}
+
 	private:
 		ymfm::ym2151 m_chip;
 		int32_t m_timers[2];
@@ -93,8 +103,8 @@ class ym2151_interface : public ymfm::ymfm_interface {
 };
 
 namespace {
-	ym2151_interface opm_iface;
-	bool initialized = false;
+	machine_local ym2151_interface opm_iface;
+	machine_local bool initialized = false;
 }
 
 extern "C" {
@@ -128,4 +138,29 @@ extern "C" {
 		else
 			return false;
 	}
+
+	void YM_state(state_t *s) {
+		std::vector<uint8_t> buffer;
+		uint32_t size = 0;
+
+		if (!s->loading) {
+			ymfm::ymfm_saved_state state(buffer, true);
+			opm_iface.save_restore(state);
+			size = buffer.size();
+		}
+		STATE(s, initialized);
+		STATE(s, size);
+		if (s->loading) {
+			if (s->error || size > s->capacity - s->pos) {
+				s->error = true;
+				return;
+			}
+			buffer.resize(size);
+		}
+		state_data(s, buffer.data(), size);
+		if (s->loading) {
+			ymfm::ymfm_saved_state state(buffer, false);
+			opm_iface.save_restore(state);
+		}
+	}
 }